@@ -0,0 +1,260 @@
+#include "vector.cpp"
+#include "dev_vector.cpp"
+#include "simd_algorithms.cpp"
+#include "test_objects.cpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Значение i-го элемента тестовой последовательности
+    template <typename T>
+    T MakeValue(int i) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            // Строка длиннее буфера SSO, чтобы копирование обращалось к куче
+            return std::string(32, static_cast<char>('a' + i % 26));
+        }
+        else if constexpr (std::is_same_v<T, Obj>) {
+            return Obj(i);
+        }
+        else if constexpr (std::is_same_v<T, TestObj>) {
+            return TestObj{};
+        }
+        else {
+            return static_cast<T>(i);
+        }
+    }
+
+    // Единый интерфейс к Vector и std::vector
+    template <typename T>
+    void PushBack(Vector<T>& v, T&& value) {
+        v.PushBack(std::move(value));
+    }
+    template <typename T>
+    void PushBack(std::vector<T>& v, T&& value) {
+        v.push_back(std::move(value));
+    }
+
+    template <typename T>
+    void EmplaceBack(Vector<T>& v, int i) {
+        v.EmplaceBack(MakeValue<T>(i));
+    }
+    template <typename T>
+    void EmplaceBack(std::vector<T>& v, int i) {
+        v.emplace_back(MakeValue<T>(i));
+    }
+
+    template <typename T>
+    void Reserve(Vector<T>& v, size_t n) {
+        v.Reserve(n);
+    }
+    template <typename T>
+    void Reserve(std::vector<T>& v, size_t n) {
+        v.reserve(n);
+    }
+
+    template <typename T>
+    void Resize(Vector<T>& v, size_t n) {
+        v.Resize(n);
+    }
+    template <typename T>
+    void Resize(std::vector<T>& v, size_t n) {
+        v.resize(n);
+    }
+
+    template <typename T>
+    void InsertMiddle(Vector<T>& v, T&& value) {
+        v.Insert(v.begin() + v.Size() / 2, std::move(value));
+    }
+    template <typename T>
+    void InsertMiddle(std::vector<T>& v, T&& value) {
+        v.insert(v.begin() + v.size() / 2, std::move(value));
+    }
+
+    template <typename T>
+    void EraseMiddle(Vector<T>& v) {
+        v.Erase(v.begin() + v.Size() / 2);
+    }
+    template <typename T>
+    void EraseMiddle(std::vector<T>& v) {
+        v.erase(v.begin() + v.size() / 2);
+    }
+
+    template <typename Container>
+    Container MakeFilled(int n) {
+        using T = std::decay_t<decltype(*std::declval<Container&>().begin())>;
+        Container v;
+        Reserve(v, n);
+        for (int i = 0; i < n; ++i) {
+            PushBack(v, MakeValue<T>(i));
+        }
+        return v;
+    }
+
+    template <typename Container>
+    void BM_PushBackGrowth(benchmark::State& state) {
+        using T = std::decay_t<decltype(*std::declval<Container&>().begin())>;
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state) {
+            Container v;
+            for (int i = 0; i < n; ++i) {
+                PushBack(v, MakeValue<T>(i));
+            }
+            benchmark::DoNotOptimize(&*v.begin());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <typename Container>
+    void BM_EmplaceBackReserved(benchmark::State& state) {
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state) {
+            Container v;
+            Reserve(v, n);
+            for (int i = 0; i < n; ++i) {
+                EmplaceBack(v, i);
+            }
+            benchmark::DoNotOptimize(&*v.begin());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <typename Container>
+    void BM_Reserve(benchmark::State& state) {
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state) {
+            state.PauseTiming();
+            Container v = MakeFilled<Container>(n);
+            state.ResumeTiming();
+            Reserve(v, n * 2);
+            benchmark::DoNotOptimize(&*v.begin());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <typename Container>
+    void BM_InsertEraseMiddle(benchmark::State& state) {
+        using T = std::decay_t<decltype(*std::declval<Container&>().begin())>;
+        const int n = static_cast<int>(state.range(0));
+        Container v = MakeFilled<Container>(n);
+        Reserve(v, n + 1);
+        int i = 0;
+        for (auto _ : state) {
+            InsertMiddle(v, MakeValue<T>(++i));
+            EraseMiddle(v);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    // Копирующее присваивание в вектор, ёмкости которого хватает (range(1) != 0) или не хватает
+    template <typename Container>
+    void BM_CopyAssign(benchmark::State& state) {
+        const int n = static_cast<int>(state.range(0));
+        const bool has_capacity = state.range(1) != 0;
+        const Container source = MakeFilled<Container>(n);
+        for (auto _ : state) {
+            state.PauseTiming();
+            Container target;
+            if (has_capacity) {
+                target = MakeFilled<Container>(n);
+            }
+            state.ResumeTiming();
+            target = source;
+            benchmark::DoNotOptimize(&*target.begin());
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <typename Container>
+    void BM_Resize(benchmark::State& state) {
+        const int n = static_cast<int>(state.range(0));
+        for (auto _ : state) {
+            Container v;
+            Resize(v, n);
+            benchmark::DoNotOptimize(&*v.begin());
+            Resize(v, n / 2);
+            Resize(v, n);
+        }
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    template <typename T>
+    void PopFront(Vector<T>& v) {
+        v.Erase(v.begin());
+    }
+    template <typename T>
+    void PopFront(DevVector<T>& v) {
+        v.PopFront();
+    }
+
+    // Скользящее окно из range(0) элементов: удаление из начала и добавление в конец
+    template <typename Container>
+    void BM_SlidingWindow(benchmark::State& state) {
+        using T = std::decay_t<decltype(*std::declval<Container&>().begin())>;
+        const int n = static_cast<int>(state.range(0));
+        Container v;
+        for (int i = 0; i < n; ++i) {
+            v.PushBack(MakeValue<T>(i));
+        }
+        int next = n;
+        for (auto _ : state) {
+            PopFront(v);
+            v.PushBack(MakeValue<T>(next++));
+            benchmark::DoNotOptimize(&*v.begin());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Поиск отсутствующего значения по всему вектору: std::find (range(1) < 0)
+    // или simd::Find с набором инструкций simd::Isa(range(1))
+    void BM_Find(benchmark::State& state) {
+        const size_t n = static_cast<size_t>(state.range(0));
+        Vector<int32_t> v(n);
+        std::iota(v.begin(), v.end(), 0);
+        const int32_t missing = -1;
+        if (state.range(1) >= 0) {
+            const auto isa = static_cast<simd::Isa>(state.range(1));
+            if (isa > simd::DetectIsa()) {
+                state.SkipWithError("instruction set is not supported");
+                return;
+            }
+            simd::LimitIsa(isa);
+        }
+        for (auto _ : state) {
+            const int32_t* found = state.range(1) < 0 ? std::find(v.begin(), v.end(), missing) : simd::Find(v, missing);
+            benchmark::DoNotOptimize(found);
+        }
+        simd::LimitIsa(simd::Isa::AVX512);
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+}  // namespace
+
+#define VECTOR_BENCHMARK(name, type, ...)                         \
+    BENCHMARK_TEMPLATE(name, Vector<type>)->__VA_ARGS__;          \
+    BENCHMARK_TEMPLATE(name, std::vector<type>)->__VA_ARGS__
+
+#define VECTOR_BENCHMARK_ALL_TYPES(name, ...)                     \
+    VECTOR_BENCHMARK(name, int, __VA_ARGS__);                     \
+    VECTOR_BENCHMARK(name, std::string, __VA_ARGS__);             \
+    VECTOR_BENCHMARK(name, Obj, __VA_ARGS__);                     \
+    VECTOR_BENCHMARK(name, TestObj, __VA_ARGS__)
+
+VECTOR_BENCHMARK_ALL_TYPES(BM_PushBackGrowth, Range(8, 1 << 16));
+VECTOR_BENCHMARK_ALL_TYPES(BM_EmplaceBackReserved, Range(8, 1 << 16));
+VECTOR_BENCHMARK_ALL_TYPES(BM_Reserve, Range(8, 1 << 16));
+VECTOR_BENCHMARK_ALL_TYPES(BM_InsertEraseMiddle, Range(64, 1 << 14));
+VECTOR_BENCHMARK_ALL_TYPES(BM_CopyAssign, Ranges({ { 64, 1 << 14 }, { 0, 1 } }));
+VECTOR_BENCHMARK_ALL_TYPES(BM_Resize, Range(64, 1 << 16));
+
+BENCHMARK_TEMPLATE(BM_SlidingWindow, Vector<int>)->Range(64, 1 << 14);
+BENCHMARK_TEMPLATE(BM_SlidingWindow, DevVector<int>)->Range(64, 1 << 14);
+BENCHMARK_TEMPLATE(BM_SlidingWindow, Vector<std::string>)->Range(64, 1 << 14);
+BENCHMARK_TEMPLATE(BM_SlidingWindow, DevVector<std::string>)->Range(64, 1 << 14);
+
+BENCHMARK(BM_Find)->ArgsProduct({ { 1 << 10, 1 << 16, 1 << 20 }, { -1, 0, 1, 2, 3 } });
+
+BENCHMARK_MAIN();
@@ -0,0 +1,218 @@
+#pragma once
+#include "vector.cpp"
+
+#include <atomic>
+#include <iterator>
+
+namespace detail {
+
+    // Номер старшего единичного бита; value != 0
+    inline size_t Log2(size_t value) noexcept {
+        assert(value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+        return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+#else
+        size_t result = 0;
+        while (value >>= 1) {
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+}  // namespace detail
+
+// Вектор, в который несколько потоков могут одновременно добавлять элементы, пока другие их читают.
+// Элементы хранятся в сегментах RawMemory, размер которых растёт вдвое: сегмент k вмещает
+// FIRST_SEGMENT_SIZE * 2^k элементов. Сегменты никогда не переносятся, поэтому ссылки на элементы
+// остаются действительными до Freeze, Clear или разрушения вектора.
+// Добавление не блокируется: индекс под элемент закрепляется счётчиком claimed_, а созданный элемент
+// отмечается флагом готовности в параллельном сегменте флагов. Size() сообщает длину начала вектора,
+// в котором все элементы созданы, и продвигает по флагам общую отметку size_
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentVector {
+    using Flag = std::atomic<bool>;
+    using FlagAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Flag>;
+
+    static constexpr size_t FIRST_SEGMENT_BITS = 5;
+    static constexpr size_t MAX_SEGMENTS = sizeof(size_t) * 8 - FIRST_SEGMENT_BITS;
+public:
+    static constexpr size_t FIRST_SEGMENT_SIZE = size_t{ 1 } << FIRST_SEGMENT_BITS;
+
+    ConcurrentVector() = default;
+
+    explicit ConcurrentVector(const Alloc& alloc) noexcept
+        : alloc_(alloc) {
+    }
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    ~ConcurrentVector() {
+        Clear();
+    }
+
+    // Потокобезопасно добавляет элемент и возвращает ссылку на него, не дожидаясь других потоков.
+    // Элемент, конструктор которого может бросить исключение, создаётся до того, как за ним
+    // закрепляется индекс, поэтому исключение не оставляет пропусков. Size() учитывает элемент,
+    // когда созданы и все элементы перед ним
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        static_assert(std::is_nothrow_move_constructible_v<T>
+            || std::is_nothrow_constructible_v<T, Args&&...>,
+            "ConcurrentVector requires a non-throwing way to place the element into its slot");
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            return Place(std::forward<Args>(args)...);
+        }
+        else {
+            T value(std::forward<Args>(args)...);
+            return Place(std::move(value));
+        }
+    }
+
+    template <typename Type>
+    T& PushBack(Type&& value) {
+        return EmplaceBack(std::forward<Type>(value));
+    }
+
+    // Количество элементов в начале вектора, каждый из которых уже создан. Элементы с индексами
+    // меньше Size() можно читать из любого потока. Продвигает отметку size_ до первого несозданного
+    // элемента, чтобы следующие вызовы не проверяли флаги заново
+    size_t Size() const noexcept {
+        size_t size = size_.load(std::memory_order_acquire);
+        size_t end = size;
+        while (IsConstructed(end)) {
+            ++end;
+        }
+        while (size < end && !size_.compare_exchange_weak(size, end, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+        }
+        return std::max(size, end);
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<ConcurrentVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < Size());
+        const auto [segment, offset] = Locate(index);
+        return segment_data_[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    // Переносит элементы в непрерывный Vector и очищает контейнер, сохраняя выделенные сегменты.
+    // Вызывается, когда все добавления завершены
+    Vector<T, Alloc> Freeze() {
+        const size_t size = Size();
+        Vector<T, Alloc> result(alloc_);
+        result.Reserve(size);
+        ForEachSegment(size, [&result](T* data, size_t count) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                result.Append(data, data + count);
+            }
+            else {
+                result.Append(std::make_move_iterator(data), std::make_move_iterator(data + count));
+            }
+        });
+        Clear();
+        return result;
+    }
+
+    // Разрушает элементы, сохраняя сегменты. Не должен выполняться одновременно с другими операциями
+    void Clear() noexcept {
+        const size_t size = Size();
+        ForEachSegment(size, [](T* data, size_t count) {
+            std::destroy_n(data, count);
+        });
+        for (size_t segment = 0, first = 0; first < size; first += SegmentSize(segment), ++segment) {
+            Flag* flags = flag_data_[segment].load(std::memory_order_relaxed);
+            for (size_t i = 0, count = std::min(SegmentSize(segment), size - first); i < count; ++i) {
+                flags[i].store(false, std::memory_order_relaxed);
+            }
+        }
+        size_.store(0, std::memory_order_release);
+        claimed_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static size_t SegmentSize(size_t segment) noexcept {
+        return FIRST_SEGMENT_SIZE << segment;
+    }
+
+    // Номер сегмента и смещение в нём для элемента index
+    static std::pair<size_t, size_t> Locate(size_t index) noexcept {
+        const size_t shifted = index + FIRST_SEGMENT_SIZE;
+        const size_t high_bit = detail::Log2(shifted);
+        return { high_bit - FIRST_SEGMENT_BITS, shifted - (size_t{ 1 } << high_bit) };
+    }
+
+    // Закрепляет индекс, создаёт элемент в памяти под него и отмечает элемент созданным.
+    // Флаг записывается с release, поэтому увидевший его поток видит и созданный элемент
+    template <typename... Args>
+    T& Place(Args&&... args) {
+        const auto [slot, flag] = ReserveSlot();
+        T* element = new (slot) T(std::forward<Args>(args)...);
+        flag->store(true, std::memory_order_release);
+        return *element;
+    }
+
+    // Закрепляет за вызывающим потоком следующий индекс и возвращает память под элемент и его флаг
+    std::pair<T*, Flag*> ReserveSlot() {
+        size_t index = claimed_.load(std::memory_order_relaxed);
+        while (true) {
+            const auto [segment, offset] = Locate(index);
+            T* data = EnsureSegment(segment_data_[segment], segments_[segment], segment, alloc_);
+            Flag* flags = EnsureSegment(flag_data_[segment], flag_segments_[segment], segment, FlagAlloc(alloc_));
+            if (claimed_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed)) {
+                return { data + offset, flags + offset };
+            }
+        }
+    }
+
+    // Создан ли элемент index. Пока поток не видит сегмент флагов, элементы сегмента считаются несозданными
+    bool IsConstructed(size_t index) const noexcept {
+        const auto [segment, offset] = Locate(index);
+        const Flag* flags = flag_data_[segment].load(std::memory_order_acquire);
+        return flags != nullptr && flags[offset].load(std::memory_order_acquire);
+    }
+
+    // Возвращает сегмент ячеек U, выделяя его при необходимости. Из нескольких потоков, одновременно
+    // выделивших один сегмент, публикует его только один, остальные освобождают свою память.
+    // Флаги создаются до публикации сегмента, ячейки элементов остаются неинициализированными
+    template <typename U, typename UAlloc>
+    static U* EnsureSegment(std::atomic<U*>& published, RawMemory<U, UAlloc>& owner, size_t segment,
+        const UAlloc& alloc) {
+        assert(segment < MAX_SEGMENTS);
+        U* data = published.load(std::memory_order_acquire);
+        if (data != nullptr) {
+            return data;
+        }
+        RawMemory<U, UAlloc> memory(SegmentSize(segment), alloc);
+        if constexpr (std::is_same_v<U, Flag>) {
+            std::uninitialized_value_construct_n(memory.GetAddress(), SegmentSize(segment));
+        }
+        if (published.compare_exchange_strong(data, memory.GetAddress(),
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+            data = memory.GetAddress();
+            owner = std::move(memory);
+        }
+        return data;
+    }
+
+    // Вызывает action(data, count) для заполненных частей сегментов, содержащих первые size элементов
+    template <typename Action>
+    void ForEachSegment(size_t size, Action action) {
+        for (size_t segment = 0, first = 0; first < size; first += SegmentSize(segment), ++segment) {
+            action(segment_data_[segment].load(std::memory_order_acquire), std::min(SegmentSize(segment), size - first));
+        }
+    }
+
+    Alloc alloc_;
+    RawMemory<T, Alloc> segments_[MAX_SEGMENTS];
+    std::atomic<T*> segment_data_[MAX_SEGMENTS] = {};
+    RawMemory<Flag, FlagAlloc> flag_segments_[MAX_SEGMENTS];
+    std::atomic<Flag*> flag_data_[MAX_SEGMENTS] = {};
+    alignas(64) std::atomic<size_t> claimed_{ 0 };
+    // Длина созданного начала вектора, известная на момент последнего вызова Size()
+    alignas(64) mutable std::atomic<size_t> size_{ 0 };
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include "vector.cpp"
+
+#include <stdexcept>
+
+// Вектор фиксированной ёмкости N, который заполняется при компиляции. Таблица, объявленная
+// constexpr, хранится в секции констант программы и не вычисляется при запуске. Элементы лежат
+// в обычном массиве, поэтому T должен быть литеральным типом с конструктором по умолчанию
+// и присваиванием. Читать таблицу можно прямо через VectorView, а ToVector копирует её
+// в Vector одним проходом memcpy
+template <typename T, size_t N>
+class ConstexprVector {
+    static_assert(std::is_trivially_destructible_v<T>, "ConstexprVector requires a literal element type");
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr ConstexprVector() = default;
+
+    constexpr ConstexprVector(std::initializer_list<T> init) {
+        CheckCapacity(init.size());
+        for (const T& value : init) {
+            data_[size_++] = value;
+        }
+    }
+
+    constexpr iterator begin() noexcept {
+        return data_;
+    }
+    constexpr iterator end() noexcept {
+        return data_ + size_;
+    }
+    constexpr const_iterator begin() const noexcept {
+        return data_;
+    }
+    constexpr const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+    constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    constexpr size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    constexpr const T& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    constexpr T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    // Переполнение при вычислении во время компиляции делает выражение неконстантным,
+    // и компилятор сообщает об ошибке
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args) {
+        CheckCapacity(size_ + 1);
+        data_[size_] = T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    constexpr void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    constexpr void PopBack() noexcept {
+        if (size_ > 0) {
+            --size_;
+        }
+    }
+
+    constexpr void Resize(size_t new_size) {
+        CheckCapacity(new_size);
+        for (size_t i = size_; i < new_size; ++i) {
+            data_[i] = T();
+        }
+        size_ = new_size;
+    }
+
+    constexpr void Clear() noexcept {
+        size_ = 0;
+    }
+
+    // Копирует элементы в Vector, выделяя память один раз
+    template <typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+    Vector<T, Alloc, Growth> ToVector(const Alloc& alloc = Alloc()) const {
+        Vector<T, Alloc, Growth> result(alloc);
+        result.Append(begin(), end());
+        return result;
+    }
+
+private:
+    static constexpr void CheckCapacity(size_t size) {
+        if (size > N) {
+            detail::Throw(std::length_error("ConstexprVector capacity exceeded"));
+        }
+    }
+
+    T data_[N]{};
+    size_t size_ = 0;
+};
+
+// Таблица из size значений generator(0), ..., generator(size - 1), построенная при компиляции,
+// если generator можно вычислить при компиляции
+template <typename T, size_t N, typename Generator>
+constexpr ConstexprVector<T, N> MakeConstexprVector(size_t size, Generator generator) {
+    ConstexprVector<T, N> result;
+    for (size_t i = 0; i < size; ++i) {
+        result.EmplaceBack(generator(i));
+    }
+    return result;
+}
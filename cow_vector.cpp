@@ -0,0 +1,236 @@
+#pragma once
+#include "vector.cpp"
+#include "vector_view.cpp"
+
+#include <atomic>
+
+// Вектор с копированием при записи. Копии разделяют один буфер со счётчиком ссылок, поэтому
+// копирование занимает O(1). Перед первым изменяющим вызовом копия, буфер которой разделён
+// с другими, получает собственный буфер. Разные объекты, разделяющие буфер, можно читать и
+// изменять из разных потоков; один объект, как и Vector, потокобезопасным не является.
+// Неконстантный доступ к элементам (begin, end, operator[], Mutable) делает буфер неразделяемым:
+// пока выданные ссылки действительны, копия вектора сразу получает собственный буфер, и запись
+// через эти ссылки в неё не попадает. Ссылки становятся недействительными при следующем изменяющем
+// вызове, после которого буфер снова разделяется с копиями
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+class CowVector {
+    using Data = Vector<T, Alloc, Growth>;
+
+    struct Shared {
+        explicit Shared(Data&& data) noexcept
+            : data(std::move(data)) {
+        }
+
+        std::atomic<size_t> refs{ 1 };
+        Data data;
+    };
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = Alloc;
+
+    CowVector() = default;
+
+    CowVector(std::initializer_list<T> init)
+        : CowVector(Data(init)) {
+    }
+
+    // Забирает элементы вектора data без копирования
+    explicit CowVector(Data&& data)
+        : shared_(data.Size() != 0 ? new Shared(std::move(data)) : nullptr) {
+    }
+
+    CowVector(const CowVector& other)
+        : shared_(other.unshareable_ ? other.Copy(other.Size()) : other.shared_) {
+        if (shared_ != nullptr && !other.unshareable_) {
+            shared_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    CowVector(CowVector&& other) noexcept
+        : shared_(std::exchange(other.shared_, nullptr))
+        , unshareable_(std::exchange(other.unshareable_, false)) {
+    }
+
+    CowVector& operator=(const CowVector& rhs) {
+        CowVector rhs_copy(rhs);
+        Swap(rhs_copy);
+        return *this;
+    }
+
+    CowVector& operator=(CowVector&& rhs) noexcept {
+        CowVector rhs_moved(std::move(rhs));
+        Swap(rhs_moved);
+        return *this;
+    }
+
+    ~CowVector() {
+        Release();
+    }
+
+    void Swap(CowVector& other) noexcept {
+        std::swap(shared_, other.shared_);
+        std::swap(unshareable_, other.unshareable_);
+    }
+
+    const_iterator begin() const noexcept {
+        return shared_ != nullptr ? shared_->data.begin() : nullptr;
+    }
+    const_iterator end() const noexcept {
+        return begin() + Size();
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    // Неконстантный доступ к элементам отделяет буфер от копий и делает его неразделяемым
+    iterator begin() {
+        return Mutable().begin();
+    }
+    iterator end() {
+        return Mutable().end();
+    }
+
+    size_t Size() const noexcept {
+        return shared_ != nullptr ? shared_->data.Size() : 0;
+    }
+
+    size_t Capacity() const noexcept {
+        return shared_ != nullptr ? shared_->data.Capacity() : 0;
+    }
+
+    // Буфер разделён с другими копиями
+    bool IsShared() const noexcept {
+        return shared_ != nullptr && shared_->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    VectorView<const T> View() const noexcept {
+        return VectorView<const T>(begin(), Size());
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        assert(index < Size());
+        return shared_->data[index];
+    }
+
+    T& operator[](size_t index) {
+        assert(index < Size());
+        return Mutable()[index];
+    }
+
+    // Собственный вектор элементов, который можно изменять через интерфейс Vector. Буфер остаётся
+    // неразделяемым до следующего изменяющего вызова CowVector
+    Data& Mutable() {
+        Detach(Size());
+        unshareable_ = true;
+        return shared_->data;
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    // Аргументы могут ссылаться на элементы самого вектора: при отделении буфера разделённый
+    // буфер освобождается только после создания нового элемента
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (IsShared()) {
+            Shared* copy = Copy(Size() + 1);
+            try {
+                copy->data.EmplaceBack(std::forward<Args>(args)...);
+            }
+            catch (...) {
+                delete copy;
+                throw;
+            }
+            Release();
+            shared_ = copy;
+            return shared_->data[shared_->data.Size() - 1];
+        }
+        Detach(Size() + 1);
+        return shared_->data.EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        if (Size() > 0) {
+            Detach(Size());
+            shared_->data.PopBack();
+        }
+    }
+
+    void Erase(size_t index) {
+        Erase(index, index + 1);
+    }
+
+    void Erase(size_t first, size_t last) {
+        assert(first <= last && last <= Size());
+        if (first != last) {
+            Detach(Size());
+            Data& data = shared_->data;
+            data.Erase(data.begin() + first, data.begin() + last);
+        }
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > Capacity() || IsShared()) {
+            Detach(new_capacity);
+            shared_->data.Reserve(new_capacity);
+        }
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size != Size()) {
+            Detach(new_size);
+            shared_->data.Resize(new_size);
+        }
+    }
+
+    // Отказывается от элементов; буфер, разделённый с копиями, остаётся им
+    void Clear() noexcept {
+        Release();
+        unshareable_ = false;
+    }
+
+private:
+    // Обеспечивает собственный буфер ёмкостью не меньше min_capacity и снова разрешает разделять
+    // его с копиями. При исключении вектор не изменяется
+    void Detach(size_t min_capacity) {
+        if (shared_ == nullptr) {
+            Data data;
+            data.Reserve(min_capacity);
+            shared_ = new Shared(std::move(data));
+        }
+        else if (IsShared()) {
+            Shared* copy = Copy(min_capacity);
+            Release();
+            shared_ = copy;
+        }
+        unshareable_ = false;
+    }
+
+    // Копирует элементы в новый буфер ёмкостью не меньше min_capacity
+    Shared* Copy(size_t min_capacity) const {
+        Data data(shared_->data.GetAllocator());
+        data.Reserve(std::max(min_capacity, Size()));
+        data.Append(begin(), end());
+        return new Shared(std::move(data));
+    }
+
+    void Release() noexcept {
+        if (shared_ != nullptr) {
+            if (shared_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete shared_;
+            }
+            shared_ = nullptr;
+        }
+    }
+
+    Shared* shared_ = nullptr;
+    // Выданы неконстантные ссылки на элементы; копирование не разделяет буфер
+    bool unshareable_ = false;
+};
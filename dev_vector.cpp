@@ -0,0 +1,367 @@
+#pragma once
+#include "vector.cpp"
+
+namespace detail {
+
+    // Вставляет элемент в позицию pos массива data, перед которым есть место ещё под один элемент,
+    // сдвигая pos первых элементов к началу. Возвращает адрес нового элемента, равный data + pos - 1
+    template <typename T, typename... Args>
+    T* EmplaceShiftFront(T* data, size_t pos, Args&&... args) {
+        if (pos == 0) {
+            return new (data - 1) T(std::forward<Args>(args)...);
+        }
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            // Элемент создаётся до сдвига, так как args могут ссылаться на элементы самого массива
+            alignas(T) unsigned char slot[sizeof(T)];
+            T* value = new (slot) T(std::forward<Args>(args)...);
+            RelocateOverlappingN(data, pos, data - 1);
+            UninitializedRelocateN(value, 1, data + pos - 1);
+        }
+        else {
+            T value(std::forward<Args>(args)...);
+            new (data - 1) T(std::move(data[0]));
+            ADVANCED_VECTOR_TRY {
+                std::move(data + 1, data + pos, data);
+                data[pos - 1] = std::move(value);
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                std::destroy_at(data - 1);
+                ADVANCED_VECTOR_RETHROW;
+            }
+        }
+        return data + pos - 1;
+    }
+
+    // Удаляет count элементов, начиная с позиции pos, массива data, сдвигая pos первых элементов
+    // к концу. Оставшиеся элементы начинаются с data + count
+    template <typename T>
+    void EraseShiftFront(T* data, size_t pos, size_t count = 1) noexcept {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            std::destroy_n(data + pos, count);
+            RelocateOverlappingN(data, pos, data + count);
+        }
+        else {
+            std::move_backward(data, data + pos, data + pos + count);
+            std::destroy_n(data, count);
+        }
+    }
+
+    // Переносит count элементов в пересекающийся участок памяти перемещением и разрушением исходных.
+    // Элементы обходятся в сторону сдвига, поэтому каждый создаётся в уже освобождённой ячейке
+    template <typename T>
+    void MoveOverlappingN(T* from, size_t count, T* to) noexcept {
+        static_assert(std::is_nothrow_move_constructible_v<T>);
+        if (to < from) {
+            for (size_t i = 0; i < count; ++i) {
+                new (to + i) T(std::move(from[i]));
+                DestroyAt(from + i);
+            }
+        }
+        else if (to > from) {
+            for (size_t i = count; i-- > 0;) {
+                new (to + i) T(std::move(from[i]));
+                DestroyAt(from + i);
+            }
+        }
+        stats::OnMove<T>(count);
+    }
+
+}  // namespace detail
+
+// Вектор со свободным местом с обеих сторон одного буфера RawMemory. Вставка и удаление в начале
+// выполняются за амортизированное O(1), вставка и удаление в середине сдвигают меньшую из частей.
+// Элементы всегда лежат непрерывно, поэтому вектор передаётся в VectorView и другие функции,
+// принимающие указатель и размер
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+class DevVector {
+    using AllocTraits = std::allocator_traits<Alloc>;
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = Alloc;
+
+    DevVector() = default;
+
+    explicit DevVector(const Alloc& alloc) noexcept
+        : data_(alloc) {
+    }
+
+    explicit DevVector(size_t size, const Alloc& alloc = Alloc())
+        : data_(size, alloc) {
+        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        size_ = size;
+    }
+
+    DevVector(std::initializer_list<T> init, const Alloc& alloc = Alloc())
+        : data_(init.size(), alloc) {
+        detail::UninitializedCopyN(init.begin(), init.size(), data_.GetAddress());
+        size_ = init.size();
+    }
+
+    DevVector(const DevVector& other)
+        : data_(other.size_, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+        detail::UninitializedCopyN(other.begin(), other.size_, data_.GetAddress());
+        size_ = other.size_;
+    }
+
+    DevVector(DevVector&& other) noexcept
+        : data_(other.GetAllocator()) {
+        Swap(other);
+    }
+
+    DevVector& operator=(const DevVector& rhs) {
+        if (this != &rhs) {
+            DevVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    DevVector& operator=(DevVector&& rhs) noexcept {
+        if (this != &rhs) {
+            DevVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    ~DevVector() {
+        std::destroy_n(begin(), size_);
+    }
+
+    void Swap(DevVector& other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(offset_, other.offset_);
+        std::swap(size_, other.size_);
+    }
+
+    iterator begin() noexcept {
+        return data_.GetAddress() + offset_;
+    }
+    iterator end() noexcept {
+        return begin() + size_;
+    }
+    const_iterator begin() const noexcept {
+        return data_.GetAddress() + offset_;
+    }
+    const_iterator end() const noexcept {
+        return begin() + size_;
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    // Количество элементов, которые можно добавить в начало без переноса остальных
+    size_t FrontSpace() const noexcept {
+        return offset_;
+    }
+
+    // Количество элементов, которые можно добавить в конец без переноса остальных
+    size_t BackSpace() const noexcept {
+        return Capacity() - offset_ - size_;
+    }
+
+    const Alloc& GetAllocator() const noexcept {
+        return data_.GetAllocator();
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<DevVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return begin()[index];
+    }
+
+    // Вставляет элемент, сдвигая ту часть вектора, которая короче
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        assert(pos >= begin() && pos <= end());
+        const size_t index = pos - begin();
+        return EmplaceAt(index, index < size_ - index, std::forward<Args>(args)...);
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return *EmplaceAt(size_, false, std::forward<Args>(args)...);
+    }
+
+    template <typename Type>
+    void PushFront(Type&& value) {
+        EmplaceFront(std::forward<Type>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceFront(Args&&... args) {
+        return *EmplaceAt(0, true, std::forward<Args>(args)...);
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(end() - 1);
+            --size_;
+            RecenterIfEmpty();
+        }
+    }
+
+    void PopFront() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(begin());
+            ++offset_;
+            --size_;
+            RecenterIfEmpty();
+        }
+    }
+
+    iterator Erase(const_iterator pos) noexcept {
+        return Erase(pos, pos + 1);
+    }
+
+    // Удаляет элементы [first, last), сдвигая ту из оставшихся частей, которая короче
+    iterator Erase(const_iterator first, const_iterator last) noexcept {
+        assert(first >= begin() && first <= last && last <= end());
+        const size_t index = first - begin();
+        const size_t count = last - first;
+        if (count != 0) {
+            if (index < size_ - index - count) {
+                detail::EraseShiftFront(begin(), index, count);
+                offset_ += count;
+            }
+            else {
+                detail::EraseShift(begin(), size_, index, count);
+            }
+            size_ -= count;
+            RecenterIfEmpty();
+        }
+        return begin() + index;
+    }
+
+    // Обеспечивает место в конце, чтобы вектор вырос до new_capacity элементов без переноса.
+    // Место в начале сохраняется. При исключении вектор не изменяется
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= size_ + BackSpace()) {
+            return;
+        }
+        stats::OnReallocate<T>(stats::ReallocationCause::RESERVE);
+        RawMemory<T, Alloc> new_data(offset_ + new_capacity, GetAllocator());
+        detail::UninitializedRelocateN(begin(), size_, new_data + offset_);
+        data_.Swap(new_data);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size > size_) {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(end(), new_size - size_);
+        }
+        else {
+            std::destroy_n(begin() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+        RecenterIfEmpty();
+    }
+
+    // Удаляет все элементы, сохраняя ёмкость. Свободное место делится поровну между концами
+    void Clear() noexcept {
+        std::destroy_n(begin(), size_);
+        size_ = 0;
+        RecenterIfEmpty();
+    }
+
+private:
+    // Вставляет элемент в позицию index, сдвигая начало вектора, если toward_front, иначе конец.
+    // Если с нужной стороны нет места, свободное место делится поровну между концами: в том же
+    // буфере, если он заполнен не больше чем наполовину, иначе в новом, больше прежнего. После этого
+    // у каждого конца остаётся место не меньше чем под половину элементов, поэтому вставки в оба
+    // конца выполняются за амортизированное O(1)
+    template <typename... Args>
+    iterator EmplaceAt(size_t index, bool toward_front, Args&&... args) {
+        if (toward_front ? offset_ == 0 : BackSpace() == 0) {
+            return RebalanceAndEmplace(index, toward_front, std::forward<Args>(args)...);
+        }
+        iterator result = nullptr;
+        if (toward_front) {
+            result = detail::EmplaceShiftFront(begin(), index, std::forward<Args>(args)...);
+            --offset_;
+        }
+        else {
+            result = detail::EmplaceShift(begin(), size_, index, std::forward<Args>(args)...);
+        }
+        ++size_;
+        return result;
+    }
+
+    template <typename... Args>
+    iterator RebalanceAndEmplace(size_t index, bool toward_front, Args&&... args) {
+        if (2 * (size_ + 1) <= Capacity()) {
+            // Элемент создаётся до переноса, так как args могут ссылаться на элементы самого вектора
+            T value(std::forward<Args>(args)...);
+            Recenter();
+            return EmplaceAt(index, toward_front, std::move(value));
+        }
+        stats::OnReallocate<T>(index == size_ ? stats::ReallocationCause::EMPLACE_BACK
+            : stats::ReallocationCause::EMPLACE);
+        const size_t new_capacity = Growth::NextCapacity(Capacity(), size_ + 1, sizeof(T));
+        const size_t new_offset = (new_capacity - size_ - 1) / 2;
+        RawMemory<T, Alloc> new_data(new_capacity, GetAllocator());
+        iterator result = detail::RelocateAndEmplace(begin(), size_, index, new_data + new_offset,
+            std::forward<Args>(args)...);
+        data_.Swap(new_data);
+        offset_ = new_offset;
+        ++size_;
+        return result;
+    }
+
+    // Переносит элементы в середину буфера. Тривиально переносимые элементы сдвигаются на месте
+    // побайтово, элементы с перемещением без исключений — перемещением на месте. Только элементы,
+    // перемещение которых может бросить исключение, переносятся в новый буфер той же ёмкости,
+    // чтобы при исключении вектор не изменился
+    void Recenter() {
+        const size_t new_offset = (Capacity() - size_) / 2;
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            detail::RelocateOverlappingN(begin(), size_, data_ + new_offset);
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            detail::MoveOverlappingN(begin(), size_, data_ + new_offset);
+        }
+        else {
+            RawMemory<T, Alloc> new_data(Capacity(), GetAllocator());
+            detail::UninitializedRelocateN(begin(), size_, new_data + new_offset);
+            data_.Swap(new_data);
+        }
+        offset_ = new_offset;
+    }
+
+    void RecenterIfEmpty() noexcept {
+        if (size_ == 0) {
+            offset_ = Capacity() / 2;
+        }
+    }
+
+    RawMemory<T, Alloc> data_;
+    size_t offset_ = 0;
+    size_t size_ = 0;
+};
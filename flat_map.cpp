@@ -0,0 +1,277 @@
+#pragma once
+#include "vector.cpp"
+#include "vector_view.cpp"
+
+#include <functional>
+
+namespace detail {
+
+    // Первый элемент отсортированного массива keys из size элементов, не меньший key.
+    // Цикл без ветвлений по результату сравнения компилятор сводит к условным пересылкам,
+    // поэтому поиск не страдает от непредсказуемых переходов
+    template <typename K, typename Compare>
+    size_t LowerBound(const K* keys, size_t size, const K& key, const Compare& compare) {
+        if (size == 0) {
+            return 0;
+        }
+        const K* base = keys;
+        size_t length = size;
+        while (length > 1) {
+            const size_t half = length / 2;
+            base = compare(base[half], key) ? base + half : base;
+            length -= half;
+        }
+        return (base - keys) + (compare(*base, key) ? 1 : 0);
+    }
+
+    // Сортирует элементы и удаляет повторы за один проход, оставляя первый из равных.
+    // Возвращает количество оставшихся элементов
+    template <typename T, typename Less>
+    size_t SortUnique(T* first, T* last, const Less& less) {
+        std::stable_sort(first, last, less);
+        T* end = std::unique(first, last, [&less](const T& lhs, const T& rhs) {
+            return !less(lhs, rhs);
+        });
+        return end - first;
+    }
+
+}  // namespace detail
+
+// Множество, хранящее ключи по возрастанию в непрерывном Vector. Поиск — двоичный по
+// непрерывному массиву без переходов по указателям, вставка и удаление сдвигают хвост
+template <typename K, typename Compare = std::less<K>>
+class FlatSet {
+public:
+    using iterator = const K*;
+    using const_iterator = const K*;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& compare)
+        : compare_(compare) {
+    }
+
+    // Забирает ключи, сортирует их и удаляет повторы. Быстрее поштучной вставки
+    explicit FlatSet(Vector<K>&& keys, const Compare& compare = Compare())
+        : keys_(std::move(keys))
+        , compare_(compare) {
+        keys_.Erase(keys_.begin() + detail::SortUnique(keys_.begin(), keys_.end(), compare_), keys_.end());
+    }
+
+    FlatSet(std::initializer_list<K> init, const Compare& compare = Compare())
+        : FlatSet(Vector<K>(init), compare) {
+    }
+
+    const_iterator begin() const noexcept {
+        return keys_.begin();
+    }
+    const_iterator end() const noexcept {
+        return keys_.end();
+    }
+
+    size_t Size() const noexcept {
+        return keys_.Size();
+    }
+
+    // Первый ключ, не меньший key
+    const_iterator LowerBound(const K& key) const {
+        return begin() + detail::LowerBound(keys_.begin(), keys_.Size(), key, compare_);
+    }
+
+    const_iterator Find(const K& key) const {
+        const_iterator it = LowerBound(key);
+        return it != end() && !compare_(key, *it) ? it : end();
+    }
+
+    bool Contains(const K& key) const {
+        return Find(key) != end();
+    }
+
+    // Вставляет ключ, если его ещё нет. Возвращает позицию ключа и признак вставки
+    template <typename... Args>
+    std::pair<const_iterator, bool> Emplace(Args&&... args) {
+        K key(std::forward<Args>(args)...);
+        const_iterator it = LowerBound(key);
+        if (it != end() && !compare_(key, *it)) {
+            return { it, false };
+        }
+        return { keys_.Emplace(it, std::move(key)), true };
+    }
+
+    std::pair<const_iterator, bool> Insert(const K& key) {
+        return Emplace(key);
+    }
+    std::pair<const_iterator, bool> Insert(K&& key) {
+        return Emplace(std::move(key));
+    }
+
+    // Удаляет ключ и возвращает количество удалённых ключей
+    size_t Erase(const K& key) {
+        const_iterator it = Find(key);
+        if (it == end()) {
+            return 0;
+        }
+        keys_.Erase(it);
+        return 1;
+    }
+
+    void Reserve(size_t capacity) {
+        keys_.Reserve(capacity);
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+    }
+
+    const Vector<K>& Keys() const noexcept {
+        return keys_;
+    }
+
+private:
+    Vector<K> keys_;
+    Compare compare_;
+};
+
+// Отображение, хранящее ключи и значения в двух параллельных Vector, упорядоченных по ключу.
+// Поиск проходит только по плотному массиву ключей, значения не загружаются в кэш,
+// пока ключ не найден
+template <typename K, typename V, typename Compare = std::less<K>>
+class FlatMap {
+public:
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& compare)
+        : compare_(compare) {
+    }
+
+    // Забирает пары, сортирует их по ключу и удаляет повторы, оставляя первую из пар с равными ключами
+    explicit FlatMap(Vector<std::pair<K, V>>&& items, const Compare& compare = Compare())
+        : compare_(compare) {
+        const size_t size = detail::SortUnique(items.begin(), items.end(),
+            [this](const std::pair<K, V>& lhs, const std::pair<K, V>& rhs) {
+                return compare_(lhs.first, rhs.first);
+            });
+        keys_.Reserve(size);
+        values_.Reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            keys_.PushBack(std::move(items[i].first));
+            values_.PushBack(std::move(items[i].second));
+        }
+    }
+
+    FlatMap(std::initializer_list<std::pair<K, V>> init, const Compare& compare = Compare())
+        : FlatMap(Vector<std::pair<K, V>>(init), compare) {
+    }
+
+    size_t Size() const noexcept {
+        return keys_.Size();
+    }
+
+    // Позиция первого ключа, не меньшего key
+    size_t LowerBound(const K& key) const {
+        return detail::LowerBound(keys_.begin(), keys_.Size(), key, compare_);
+    }
+
+    // Значение по ключу или nullptr, если ключа нет
+    V* Find(const K& key) {
+        const size_t index = IndexOf(key);
+        return index != Size() ? &values_[index] : nullptr;
+    }
+
+    const V* Find(const K& key) const {
+        return const_cast<FlatMap&>(*this).Find(key);
+    }
+
+    bool Contains(const K& key) const {
+        return IndexOf(key) != Size();
+    }
+
+    // Вставляет значение, созданное из args, если ключа ещё нет. Возвращает значение по ключу
+    // и признак вставки. При исключении отображение не изменяется
+    template <typename... Args>
+    std::pair<V*, bool> Emplace(K key, Args&&... args) {
+        const size_t index = LowerBound(key);
+        if (IsKeyAt(index, key)) {
+            return { &values_[index], false };
+        }
+        return { &EmplaceAt(index, std::move(key), std::forward<Args>(args)...), true };
+    }
+
+    // То же, что Emplace, но ключ копируется только при вставке
+    template <typename... Args>
+    std::pair<V*, bool> TryEmplace(const K& key, Args&&... args) {
+        const size_t index = LowerBound(key);
+        if (IsKeyAt(index, key)) {
+            return { &values_[index], false };
+        }
+        return { &EmplaceAt(index, key, std::forward<Args>(args)...), true };
+    }
+
+    // Значение по ключу; отсутствующее значение создаётся конструктором по умолчанию
+    V& operator[](const K& key) {
+        return *TryEmplace(key).first;
+    }
+
+    // Удаляет ключ вместе со значением и возвращает количество удалённых пар
+    size_t Erase(const K& key) {
+        const size_t index = IndexOf(key);
+        if (index == Size()) {
+            return 0;
+        }
+        keys_.Erase(keys_.begin() + index);
+        values_.Erase(values_.begin() + index);
+        return 1;
+    }
+
+    void Reserve(size_t capacity) {
+        keys_.Reserve(capacity);
+        values_.Reserve(capacity);
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+        values_.Clear();
+    }
+
+    // Ключи по возрастанию; i-й ключ соответствует i-му значению
+    VectorView<const K> Keys() const noexcept {
+        return VectorView<const K>(keys_.begin(), keys_.Size());
+    }
+
+    VectorView<V> Values() noexcept {
+        return VectorView<V>(values_.begin(), values_.Size());
+    }
+
+    VectorView<const V> Values() const noexcept {
+        return VectorView<const V>(values_.begin(), values_.Size());
+    }
+
+private:
+    // Ключ в позиции index, найденной LowerBound(key), равен key
+    bool IsKeyAt(size_t index, const K& key) const {
+        return index != Size() && !compare_(key, keys_[index]);
+    }
+
+    size_t IndexOf(const K& key) const {
+        const size_t index = LowerBound(key);
+        return IsKeyAt(index, key) ? index : Size();
+    }
+
+    // Вставляет пару в позицию index. При исключении отображение не изменяется
+    template <typename KeyArg, typename... Args>
+    V& EmplaceAt(size_t index, KeyArg&& key, Args&&... args) {
+        keys_.Emplace(keys_.begin() + index, std::forward<KeyArg>(key));
+        ADVANCED_VECTOR_TRY {
+            values_.Emplace(values_.begin() + index, std::forward<Args>(args)...);
+        }
+        ADVANCED_VECTOR_CATCH_ALL {
+            keys_.Erase(keys_.begin() + index);
+            ADVANCED_VECTOR_RETHROW;
+        }
+        return values_[index];
+    }
+
+    Vector<K> keys_;
+    Vector<V> values_;
+    Compare compare_;
+};
@@ -0,0 +1,196 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Чем обеспечен выделенный блок памяти
+enum class MemoryBacking {
+    UPSTREAM,                // блок меньше порога и выделен вышестоящим ресурсом
+    HUGETLB,                 // явные huge pages (MAP_HUGETLB)
+    TRANSPARENT_HUGE_PAGES,  // обычный mmap с madvise(MADV_HUGEPAGE)
+    REGULAR_PAGES,           // обычный mmap: huge pages недоступны
+};
+
+// Политика размещения страниц по узлам NUMA (см. mbind(2))
+enum class NumaPolicy {
+    DEFAULT,     // как решит ядро (обычно — узел потока, первым коснувшегося страницы)
+    PREFERRED,   // по возможности на первом узле из маски
+    BIND,        // строго на узлах из маски
+    INTERLEAVE,  // поочерёдно на узлах из маски
+};
+
+struct HugePageOptions {
+    // Блоки меньшего размера выделяются вышестоящим ресурсом
+    size_t threshold = size_t{ 2 } << 20;
+    // Пытаться получить явные huge pages, прежде чем полагаться на transparent huge pages
+    bool use_hugetlb = true;
+    NumaPolicy numa_policy = NumaPolicy::DEFAULT;
+    // Битовая маска узлов NUMA для политики numa_policy
+    unsigned long numa_nodes = 0;
+};
+
+// Сведения о блоке, выделенном HugePageResource
+struct HugePageAllocationInfo {
+    MemoryBacking backing = MemoryBacking::UPSTREAM;
+    bool numa_applied = false;
+};
+
+// Ресурс памяти для крупных буферов: блоки от threshold байт выделяются через mmap на huge pages
+// и при необходимости привязываются к узлам NUMA, что снижает число промахов TLB при проходах по
+// большим векторам. Используется с pmr::Vector. Вне Linux все блоки выделяются вышестоящим ресурсом
+class HugePageResource : public std::pmr::memory_resource {
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = size_t{ 2 } << 20;
+
+    explicit HugePageResource(HugePageOptions options = {},
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : options_(options)
+        , upstream_(upstream) {
+    }
+
+    HugePageResource(const HugePageResource&) = delete;
+    HugePageResource& operator=(const HugePageResource&) = delete;
+
+    // Сообщает, чем обеспечен блок, начинающийся по адресу p
+    HugePageAllocationInfo GetAllocationInfo(const void* p) const {
+        std::lock_guard guard(mutex_);
+        auto it = mappings_.find(p);
+        return it != mappings_.end() ? it->second.info : HugePageAllocationInfo{};
+    }
+
+private:
+    struct Mapping {
+        size_t length;
+        HugePageAllocationInfo info;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+#ifdef __linux__
+        if (bytes >= options_.threshold && alignment <= HUGE_PAGE_SIZE) {
+            const size_t length = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+            Mapping mapping{ length, {} };
+            void* p = Map(length, mapping.info);
+            std::lock_guard guard(mutex_);
+            try {
+                mappings_.emplace(p, mapping);
+            }
+            catch (...) {
+                munmap(p, length);
+                throw;
+            }
+            return p;
+        }
+#endif
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+#ifdef __linux__
+        if (bytes >= options_.threshold && alignment <= HUGE_PAGE_SIZE) {
+            size_t length = 0;
+            {
+                std::lock_guard guard(mutex_);
+                auto it = mappings_.find(p);
+                assert(it != mappings_.end());
+                length = it->second.length;
+                mappings_.erase(it);
+            }
+            munmap(p, length);
+            return;
+        }
+#endif
+        upstream_->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+#ifdef __linux__
+    // Отображает length байт анонимной памяти, выбирая лучшую доступную разновидность страниц
+    void* Map(size_t length, HugePageAllocationInfo& info) const {
+        void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        if (options_.use_hugetlb) {
+            p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            info.backing = MemoryBacking::HUGETLB;
+        }
+#endif
+        if (p == MAP_FAILED) {
+            p = AlignedMap(length);
+            info.backing = MemoryBacking::REGULAR_PAGES;
+#ifdef MADV_HUGEPAGE
+            if (madvise(p, length, MADV_HUGEPAGE) == 0) {
+                info.backing = MemoryBacking::TRANSPARENT_HUGE_PAGES;
+            }
+#endif
+        }
+        info.numa_applied = ApplyNumaPolicy(p, length);
+        return p;
+    }
+
+    // Обычный mmap, выровненный по границе huge page, чтобы ядро могло собрать страницы в huge pages
+    static void* AlignedMap(size_t length) {
+        void* raw = mmap(nullptr, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        const auto address = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t aligned = (address + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        if (aligned != address) {
+            munmap(raw, aligned - address);
+        }
+        const size_t tail = HUGE_PAGE_SIZE - (aligned - address);
+        if (tail != 0) {
+            munmap(reinterpret_cast<void*>(aligned + length), tail);
+        }
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // Вызывает mbind напрямую, чтобы не зависеть от libnuma. Страницы ещё не затронуты,
+    // поэтому политика определит их размещение при первом обращении
+    bool ApplyNumaPolicy(void* p, size_t length) const noexcept {
+#ifdef SYS_mbind
+        if (options_.numa_policy == NumaPolicy::DEFAULT || options_.numa_nodes == 0) {
+            return false;
+        }
+        // Значения MPOL_* из <linux/mempolicy.h>
+        int mode = 0;
+        switch (options_.numa_policy) {
+        case NumaPolicy::PREFERRED:
+            mode = 1;
+            break;
+        case NumaPolicy::BIND:
+            mode = 2;
+            break;
+        case NumaPolicy::INTERLEAVE:
+            mode = 3;
+            break;
+        case NumaPolicy::DEFAULT:
+            break;
+        }
+        const unsigned long mask = options_.numa_nodes;
+        return syscall(SYS_mbind, p, length, mode, &mask, sizeof(mask) * 8, 0) == 0;
+#else
+        (void)p;
+        (void)length;
+        return false;
+#endif
+    }
+#endif
+
+    HugePageOptions options_;
+    std::pmr::memory_resource* upstream_;
+    mutable std::mutex mutex_;
+    std::map<const void*, Mapping> mappings_;
+};
@@ -1,104 +1,33 @@
 #include "vector.cpp"
+#include "small_vector.cpp"
+#include "concurrent_vector.cpp"
+#include "huge_page_resource.cpp"
+#include "mapped_vector.cpp"
+#include "vector_serialization.cpp"
+#include "vector_view.cpp"
+#include "soa_vector.cpp"
+#include "segmented_vector.cpp"
+#include "cow_vector.cpp"
+#include "static_vector.cpp"
+#include "simd_algorithms.cpp"
+#include "flat_map.cpp"
+#include "ring_buffer.cpp"
+#include "dev_vector.cpp"
+#include "bit_vector.cpp"
+#include "constexpr_vector.cpp"
+#include "test_objects.cpp"
 
 #include <iostream>
 #include <stdexcept>
 #include <string>
-
-namespace {
-
-    // "" ,     
-    inline const uint32_t DEFAULT_COOKIE = 0xdeadbeef;
-
-    struct TestObj {
-        TestObj() = default;
-        TestObj(const TestObj& other) = default;
-        TestObj& operator=(const TestObj& other) = default;
-        TestObj(TestObj&& other) = default;
-        TestObj& operator=(TestObj&& other) = default;
-        ~TestObj() {
-            cookie = 0;
-        }
-        [[nodiscard]] bool IsAlive() const noexcept {
-            return cookie == DEFAULT_COOKIE;
-        }
-        uint32_t cookie = DEFAULT_COOKIE;
-    };
-
-    struct Obj {
-        Obj() {
-            if (default_construction_throw_countdown > 0) {
-                if (--default_construction_throw_countdown == 0) {
-                    throw std::runtime_error("Oops");
-                }
-            }
-            ++num_default_constructed;
-        }
-
-        explicit Obj(int id)
-            : id(id)  //
-        {
-            ++num_constructed_with_id;
-        }
-
-        Obj(int id, std::string name)
-            : id(id)
-            , name(std::move(name))  //
-        {
-            ++num_constructed_with_id_and_name;
-        }
-
-        Obj(const Obj& other)
-            : id(other.id)  //
-        {
-            if (other.throw_on_copy) {
-                throw std::runtime_error("Oops");
-            }
-            ++num_copied;
-        }
-
-        Obj(Obj&& other) noexcept
-            : id(other.id)  //
-        {
-            ++num_moved;
-        }
-
-        Obj& operator=(const Obj& other) = default;
-        Obj& operator=(Obj&& other) = default;
-
-        ~Obj() {
-            ++num_destroyed;
-            id = 0;
-        }
-
-        static int GetAliveObjectCount() {
-            return num_default_constructed + num_copied + num_moved + num_constructed_with_id
-                + num_constructed_with_id_and_name - num_destroyed;
-        }
-
-        static void ResetCounters() {
-            default_construction_throw_countdown = 0;
-            num_default_constructed = 0;
-            num_copied = 0;
-            num_moved = 0;
-            num_destroyed = 0;
-            num_constructed_with_id = 0;
-            num_constructed_with_id_and_name = 0;
-        }
-
-        bool throw_on_copy = false;
-        int id = 0;
-        std::string name;
-
-        static inline int default_construction_throw_countdown = 0;
-        static inline int num_default_constructed = 0;
-        static inline int num_constructed_with_id = 0;
-        static inline int num_constructed_with_id_and_name = 0;
-        static inline int num_copied = 0;
-        static inline int num_moved = 0;
-        static inline int num_destroyed = 0;
-    };
-
-}  // namespace
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <filesystem>
+#include <random>
 
 void Test1() {
     Obj::ResetCounters();
@@ -385,6 +314,1896 @@ void Test5() {
     }
 }
 
+namespace {
+
+    // ,    
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) noexcept {
+        }
+
+        T* allocate(size_t n) {
+            ++num_allocations;
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T* p, size_t n) noexcept {
+            ++num_deallocations;
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const CountingAllocator<U>&) const noexcept {
+            return true;
+        }
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>&) const noexcept {
+            return false;
+        }
+
+        static void ResetCounters() {
+            num_allocations = 0;
+            num_deallocations = 0;
+        }
+
+        static inline int num_allocations = 0;
+        static inline int num_deallocations = 0;
+    };
+
+}  // namespace
+
+void Test6() {
+    const size_t SIZE = 100;
+    {
+        CountingAllocator<Obj>::ResetCounters();
+        Obj::ResetCounters();
+        {
+            Vector<Obj, CountingAllocator<Obj>> v(SIZE);
+            assert(CountingAllocator<Obj>::num_allocations == 1);
+            v.Reserve(SIZE * 2);
+            assert(CountingAllocator<Obj>::num_allocations == 2);
+            assert(CountingAllocator<Obj>::num_deallocations == 1);
+            const auto v_copy(v);
+            v.Insert(v.begin(), Obj{ 1 });
+            v.EmplaceBack(2);
+            assert(CountingAllocator<Obj>::num_allocations == 3);
+        }
+        assert(CountingAllocator<Obj>::num_allocations == CountingAllocator<Obj>::num_deallocations);
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::monotonic_buffer_resource other_arena;
+        pmr::Vector<int> v(&arena);
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.PushBack(i);
+        }
+        assert(v.GetAllocator().resource() == &arena);
+
+        pmr::Vector<int> v_copy(v);
+        assert(v_copy.GetAllocator().resource() == std::pmr::get_default_resource());
+
+        //      ,   
+        pmr::Vector<int> v_other(&other_arena);
+        v_other = std::move(v);
+        assert(v_other.GetAllocator().resource() == &other_arena);
+        assert(v_other.Size() == SIZE);
+        assert(v_other[SIZE - 1] == static_cast<int>(SIZE) - 1);
+    }
+}
+
+namespace {
+
+    //    ,    
+    struct RelocatableObj {
+        explicit RelocatableObj(int id)
+            : id(id) {
+        }
+        RelocatableObj(const RelocatableObj& other)
+            : id(other.id) {
+            ++num_copied;
+        }
+        RelocatableObj(RelocatableObj&& other) noexcept
+            : id(other.id) {
+            ++num_moved;
+        }
+        RelocatableObj& operator=(const RelocatableObj& other) = default;
+        RelocatableObj& operator=(RelocatableObj&& other) = default;
+        ~RelocatableObj() {
+            ++num_destroyed;
+        }
+
+        static void ResetCounters() {
+            num_copied = 0;
+            num_moved = 0;
+            num_destroyed = 0;
+        }
+
+        int id = 0;
+
+        static inline int num_copied = 0;
+        static inline int num_moved = 0;
+        static inline int num_destroyed = 0;
+    };
+
+}  // namespace
+
+template <>
+struct IsTriviallyRelocatable<RelocatableObj> : std::true_type {
+};
+
+void Test7() {
+    const size_t SIZE = 100;
+    {
+        RelocatableObj::ResetCounters();
+        Vector<RelocatableObj> v;
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Reserve(SIZE * 4);
+        v.Emplace(v.begin(), -1);
+        v.Erase(v.begin() + 1);
+        assert(RelocatableObj::num_moved == 0);
+        assert(RelocatableObj::num_copied == 0);
+        assert(RelocatableObj::num_destroyed == 1);
+        assert(v.Size() == SIZE);
+        assert(v[0].id == -1);
+        assert(v[1].id == 1);
+        assert(v[SIZE - 1].id == static_cast<int>(SIZE) - 1);
+    }
+    {
+        Vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.Emplace(v.begin() + v.Size() / 2, std::make_unique<int>(i));
+        }
+        v.Erase(v.begin());
+        assert(v.Size() == SIZE - 1);
+        for (const auto& p : v) {
+            assert(p != nullptr);
+        }
+    }
+    {
+        //      
+        Vector<int> v;
+        v.Reserve(4);
+        v.PushBack(1);
+        v.PushBack(2);
+        v.PushBack(3);
+        v.Insert(v.begin(), v[2]);
+        assert(v[0] == 3 && v[1] == 1 && v[2] == 2 && v[3] == 3);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (int i = 0; i < 5; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Erase(v.begin() + 1);
+        assert(v.Size() == 4);
+        assert(v[0].id == 0 && v[1].id == 2 && v[2].id == 3 && v[3].id == 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+namespace {
+
+    // ,      .   
+    //    
+    template <typename T>
+    struct BumpAllocator {
+        using value_type = T;
+
+        BumpAllocator() = default;
+        template <typename U>
+        BumpAllocator(const BumpAllocator<U>&) noexcept {
+        }
+
+        T* allocate(size_t n) {
+            if (top + n > ARENA_SIZE) {
+                throw std::bad_alloc();
+            }
+            ++num_allocations;
+            T* result = reinterpret_cast<T*>(arena) + top;
+            top += n;
+            return result;
+        }
+        void deallocate(T* p, size_t n) noexcept {
+            if (p + n == reinterpret_cast<T*>(arena) + top) {
+                top -= n;
+            }
+        }
+        bool try_expand(T* p, size_t old_n, size_t new_n) noexcept {
+            if (p + old_n != reinterpret_cast<T*>(arena) + top || top + new_n - old_n > ARENA_SIZE) {
+                return false;
+            }
+            top += new_n - old_n;
+            ++num_expansions;
+            return true;
+        }
+
+        template <typename U>
+        bool operator==(const BumpAllocator<U>&) const noexcept {
+            return true;
+        }
+        template <typename U>
+        bool operator!=(const BumpAllocator<U>&) const noexcept {
+            return false;
+        }
+
+        static constexpr size_t ARENA_SIZE = 4096;
+        alignas(T) static inline unsigned char arena[ARENA_SIZE * sizeof(T)];
+        static inline size_t top = 0;
+        static inline int num_allocations = 0;
+        static inline int num_expansions = 0;
+    };
+
+}  // namespace
+
+void Test8() {
+    const int SIZE = 1000;
+    {
+        Vector<int, BumpAllocator<int>> v;
+        v.PushBack(0);
+        const int* const first = &v[0];
+        for (int i = 1; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        //     :      
+        assert(&v[0] == first);
+        assert(BumpAllocator<int>::num_allocations == 1);
+        assert(BumpAllocator<int>::num_expansions == 10);
+        v.Insert(v.begin(), v[SIZE - 1]);
+        assert(v[0] == SIZE - 1);
+        assert(v[1] == 0);
+        assert(v[SIZE] == SIZE - 1);
+
+        // ,    ,     
+        Vector<int, BumpAllocator<int>> other(1);
+        v.Reserve(v.Capacity() + 1);
+        assert(&v[0] != first);
+        assert(BumpAllocator<int>::num_allocations == 3);
+        assert(v[SIZE] == SIZE - 1);
+    }
+    {
+        Vector<std::unique_ptr<int>, MallocAllocator<std::unique_ptr<int>>> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(std::make_unique<int>(i));
+            v.PushBack(std::move(v[v.Size() - 1]));
+        }
+        v.Emplace(v.begin(), std::make_unique<int>(-1));
+        assert(v.Size() == 2 * SIZE + 1);
+        assert(*v[0] == -1);
+        assert(v[1] == nullptr);
+        assert(*v[2 * SIZE] == SIZE - 1);
+    }
+}
+
+void Test9() {
+    {
+        Vector<int, std::allocator<int>, OneAndHalfGrowth> v;
+        size_t expected_capacity = 0;
+        for (int i = 0; i < 100; ++i) {
+            if (v.Size() == expected_capacity) {
+                expected_capacity = expected_capacity + expected_capacity / 2 + 1;
+            }
+            v.PushBack(i);
+            assert(v.Capacity() == expected_capacity);
+        }
+        v.Emplace(v.begin(), -1);
+        assert(v.Capacity() == expected_capacity);
+        assert(v[0] == -1 && v[100] == 99);
+    }
+    {
+        //     -
+        Vector<int, std::allocator<int>, MinCapacityGrowth<>> v;
+        v.PushBack(1);
+        assert(v.Capacity() == 64 / sizeof(int));
+        for (int i = 0; i < 16; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 2 * 64 / sizeof(int));
+
+        Vector<Obj, std::allocator<Obj>, MinCapacityGrowth<1, 8>> objects;
+        objects.EmplaceBack(1);
+        assert(objects.Capacity() == 8);
+    }
+    {
+        Vector<char, std::allocator<char>, SizeClassGrowth<>> v;
+        v.PushBack('a');
+        assert(v.Capacity() == 16);
+        for (int i = 0; i < 16; ++i) {
+            v.PushBack('b');
+        }
+        assert(v.Capacity() == 32);
+        for (int i = 0; i < 128; ++i) {
+            v.PushBack('c');
+        }
+        assert(v.Capacity() == 256);
+        assert(detail::RoundUpToSizeClass(129) == 160);
+        assert(detail::RoundUpToSizeClass(4097) == 5120);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test10() {
+    const size_t INLINE_SIZE = 8;
+    const int ID = 42;
+    using SmallObjVector = SmallVector<Obj, INLINE_SIZE>;
+    {
+        Obj::ResetCounters();
+        SmallObjVector v;
+        for (int i = 0; i < static_cast<int>(INLINE_SIZE); ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(v.IsInline());
+        assert(v.Capacity() == INLINE_SIZE);
+        assert(Obj::num_moved == 0);
+
+        v.EmplaceBack(ID);
+        assert(!v.IsInline());
+        assert(v.Capacity() == INLINE_SIZE * 2);
+        assert(Obj::num_moved == static_cast<int>(INLINE_SIZE));
+        assert(v[INLINE_SIZE].id == ID);
+
+        v.Emplace(v.begin(), -1);
+        v.Erase(v.begin() + 1);
+        assert(v.Size() == INLINE_SIZE + 1);
+        assert(v[0].id == -1 && v[1].id == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        SmallObjVector v(INLINE_SIZE / 2);
+        try {
+            v[INLINE_SIZE / 4].throw_on_copy = true;
+            SmallObjVector v_copy(v);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+            assert(Obj::num_copied == INLINE_SIZE / 4);
+        }
+        assert(Obj::GetAliveObjectCount() == INLINE_SIZE / 2);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Obj::ResetCounters();
+        SmallObjVector small(2);
+        SmallObjVector large(INLINE_SIZE * 3);
+        small[1].id = ID;
+        large[INLINE_SIZE * 3 - 1].id = ID;
+        small.Swap(large);
+        assert(small.Size() == INLINE_SIZE * 3 && !small.IsInline());
+        assert(large.Size() == 2 && large.IsInline());
+        assert(small[INLINE_SIZE * 3 - 1].id == ID);
+        assert(large[1].id == ID);
+
+        SmallObjVector other(5);
+        other.Swap(large);
+        assert(other.Size() == 2 && other[1].id == ID);
+        assert(large.Size() == 5);
+
+        SmallObjVector moved(std::move(small));
+        assert(moved.Size() == INLINE_SIZE * 3 && small.Size() == 0);
+        moved = other;
+        assert(moved.Size() == 2 && moved[1].id == ID);
+        moved.Resize(INLINE_SIZE * 4);
+        assert(moved.Size() == INLINE_SIZE * 4);
+        assert(Obj::GetAliveObjectCount() == static_cast<int>(INLINE_SIZE * 4 + 2 + 5));
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        SmallVector<TestObj, 1> v(1);
+        //  EmplaceBack     
+        //         
+        v.EmplaceBack(v[0]);
+        assert(v[0].IsAlive());
+        assert(v[1].IsAlive());
+    }
+}
+
+void Test11() {
+    const size_t SIZE = 1000;
+    {
+        Vector<int> v(SIZE, DEFAULT_INIT);
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i] = static_cast<int>(i);
+        }
+        v.ResizeUninitialized(SIZE * 2);
+        assert(v.Size() == SIZE * 2);
+        assert(v[SIZE - 1] == static_cast<int>(SIZE) - 1);
+        v.ResizeUninitialized(1);
+        assert(v.Size() == 1);
+        assert(v.Capacity() == SIZE * 2);
+    }
+    {
+        //   - 
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE, DEFAULT_INIT);
+        v.ResizeUninitialized(SIZE + 1);
+        assert(Obj::num_default_constructed == SIZE + 1);
+        v.ResizeUninitialized(0);
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+namespace {
+
+    //    ,   assignments_left 
+    struct ThrowingAssign {
+        explicit ThrowingAssign(int id = 0)
+            : id(id) {
+            ++alive;
+        }
+        ThrowingAssign(const ThrowingAssign& other)
+            : id(other.id) {
+            ++alive;
+        }
+        ThrowingAssign(ThrowingAssign&& other)
+            : id(other.id) {
+            ++alive;
+        }
+        ThrowingAssign& operator=(const ThrowingAssign& other) = default;
+        ThrowingAssign& operator=(ThrowingAssign&& other) {
+            if (assignments_left-- == 0) {
+                throw std::runtime_error("Move assignment failed");
+            }
+            id = other.id;
+            return *this;
+        }
+        ~ThrowingAssign() {
+            --alive;
+        }
+
+        int id = 0;
+
+        static inline int alive = 0;
+        static inline int assignments_left = -1;
+    };
+
+}  // namespace
+
+void Test12() {
+    {
+        Vector<int> v{ 1, 2, 3 };
+        assert(v.Size() == 3 && v.Capacity() == 3);
+        const int values[] = { 10, 20, 30, 40 };
+        v.Insert(v.begin() + 1, std::begin(values), std::end(values));
+        assert(v.Size() == 7);
+        assert(v.Capacity() == 7);
+        assert(v[0] == 1 && v[1] == 10 && v[4] == 40 && v[5] == 2 && v[6] == 3);
+
+        v.Reserve(20);
+        v.Insert(v.begin(), { 7, 8 });
+        assert(v.Capacity() == 20);
+        assert(v[0] == 7 && v[1] == 8 && v[2] == 1 && v[8] == 3);
+
+        auto it = v.Insert(v.begin() + 2, 3, v[8]);
+        assert(it == v.begin() + 2);
+        assert(v.Size() == 12);
+        assert(v[2] == 3 && v[4] == 3 && v[5] == 1 && v[11] == 3);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> source(5);
+        for (int i = 0; i < 5; ++i) {
+            source[i].id = i;
+        }
+        Vector<Obj> v(3);
+        //      ,    
+        v.Insert(v.begin() + 1, source.begin(), source.end());
+        assert(v.Size() == 8 && v.Capacity() == 8);
+        assert(Obj::num_copied == 5);
+        assert(v[0].id == 0 && v[1].id == 0 && v[5].id == 4 && v[6].id == 0);
+
+        v.Append(source.begin(), source.begin() + 2);
+        assert(v.Size() == 10 && v[9].id == 1);
+
+        //       
+        source[3].throw_on_copy = true;
+        const size_t capacity = v.Capacity();
+        try {
+            v.Insert(v.begin(), source.begin(), source.end());
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 10 && v.Capacity() == capacity && v[9].id == 1);
+        v.Reserve(20);
+        try {
+            v.Insert(v.begin(), source.begin(), source.end());
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 10 && v[0].id == 0 && v[9].id == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        std::istringstream input("4 5 6");
+        Vector<int> v{ 1, 2, 3 };
+        v.Insert(v.begin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert(v.Size() == 6);
+        assert(v[1] == 4 && v[2] == 5 && v[3] == 6 && v[4] == 2);
+    }
+    {
+        //      ,    
+        //        
+        Vector<ThrowingAssign> v;
+        v.Reserve(10);
+        for (int i = 0; i < 4; ++i) {
+            v.EmplaceBack(i);
+        }
+        ThrowingAssign::assignments_left = 2;
+        try {
+            v.Insert(v.begin() + 1, 3, ThrowingAssign(7));
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        ThrowingAssign::assignments_left = -1;
+        assert(v.Size() == 7 && v.Capacity() == 10);
+        assert(ThrowingAssign::alive == 7);
+    }
+    assert(ThrowingAssign::alive == 0);
+}
+
+void Test13() {
+    const int SIZE = 1000;
+    {
+        Vector<int> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        auto it = v.Erase(v.begin() + 10, v.begin() + 20);
+        assert(it == v.begin() + 10);
+        assert(v.Size() == SIZE - 10);
+        assert(v[9] == 9 && v[10] == 20);
+        assert(v.Erase(v.begin(), v.begin()) == v.begin());
+        v.Erase(v.begin() + 900, v.end());
+        assert(v.Size() == 900 && v[899] == 909);
+
+        assert(v.EraseIf([](int x) {
+            return x % 2 == 1;
+        }) == 450);
+        assert(v.Size() == 450);
+        assert(v[0] == 0 && v[5] == 20 && v[449] == 908);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(10);
+        for (int i = 0; i < 10; ++i) {
+            v[i].id = i;
+        }
+        v.Erase(v.begin() + 2, v.begin() + 5);
+        assert(v.Size() == 7 && v[2].id == 5 && v[6].id == 9);
+        assert(Obj::num_destroyed == 3);
+        assert(v.EraseIf([](const Obj& obj) {
+            return obj.id > 6;
+        }) == 3);
+        assert(v.Size() == 4 && v[3].id == 6);
+        assert(Obj::GetAliveObjectCount() == 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test14() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Reserve(SIZE * 4);
+        v[SIZE - 1].id = 42;
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE);
+        assert(v.Size() == SIZE);
+        assert(v[SIZE - 1].id == 42);
+        assert(Obj::num_moved == static_cast<int>(SIZE) * 2);
+        assert(Obj::num_copied == 0);
+
+        v.Clear();
+        assert(v.Size() == 0 && v.Capacity() == SIZE);
+        assert(Obj::GetAliveObjectCount() == 0);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0);
+        assert(v.begin() == nullptr);
+    }
+    {
+        CountingAllocator<int>::ResetCounters();
+        Vector<int, CountingAllocator<int>> v(SIZE);
+        v.ClearAndRelease();
+        assert(v.Size() == 0 && v.Capacity() == 0);
+        assert(CountingAllocator<int>::num_deallocations == 1);
+        v.PushBack(1);
+        assert(v[0] == 1);
+    }
+}
+
+void Test15() {
+#ifdef ADVANCED_VECTOR_STATS
+    const size_t SIZE = 100;
+    stats::Counters& counters = stats::CountersFor<Obj>();
+    counters.Reset();
+    Obj::ResetCounters();
+    {
+        Vector<Obj> v;
+        v.Reserve(SIZE);
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(counters.allocations == 1);
+        assert(counters.reserve_reallocations == 1);
+        assert(counters.emplace_back_reallocations == 0);
+
+        v.EmplaceBack(0);
+        v.Emplace(v.begin(), 0);
+        assert(counters.emplace_back_reallocations == 1);
+        assert(counters.emplace_reallocations == 0);
+        assert(counters.elements_moved == SIZE);
+        assert(counters.elements_copied == 0);
+        assert(counters.peak_capacity == SIZE * 2);
+        assert(counters.bytes_allocated == SIZE * 3 * sizeof(Obj));
+    }
+    assert(counters.deallocations == 2);
+
+    std::ostringstream out;
+    stats::Dump(out);
+    assert(out.str().find(typeid(Obj).name()) != std::string::npos);
+#endif
+}
+
+void Test16() {
+    const int NUM_THREADS = 4;
+    const int PER_THREAD = 10'000;
+    {
+        ConcurrentVector<int> v;
+        const int* first = &v.EmplaceBack(-1);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&v, t] {
+                for (int i = 0; i < PER_THREAD; ++i) {
+                    v.PushBack(t * PER_THREAD + i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        //      
+        assert(&v[0] == first);
+        assert(v.Size() == NUM_THREADS * PER_THREAD + 1);
+
+        Vector<int> frozen = v.Freeze();
+        assert(v.Size() == 0);
+        assert(frozen.Size() == NUM_THREADS * PER_THREAD + 1);
+        std::sort(frozen.begin(), frozen.end());
+        for (int i = 0; i <= NUM_THREADS * PER_THREAD; ++i) {
+            assert(frozen[i] == i - 1);
+        }
+    }
+    {
+        Obj::ResetCounters();
+        {
+            ConcurrentVector<Obj> v;
+            for (int i = 0; i < 100; ++i) {
+                v.EmplaceBack(i, "obj");
+            }
+            assert(v[99].id == 99);
+            Vector<Obj> frozen = v.Freeze();
+            assert(frozen.Size() == 100 && frozen[99].id == 99);
+            assert(Obj::num_copied == 0);
+            v.EmplaceBack(1);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // ,    ,    
+        struct Checked {
+            explicit Checked(int id) noexcept
+                : id(id)
+                , check(~id) {
+            }
+            int id;
+            int check;
+        };
+        ConcurrentVector<Checked> v;
+        std::atomic<bool> all_valid = true;
+        std::thread reader([&v, &all_valid] {
+            size_t checked = 0;
+            while (checked < static_cast<size_t>(NUM_THREADS * PER_THREAD)) {
+                const size_t size = v.Size();
+                for (; checked < size; ++checked) {
+                    if (v[checked].check != ~v[checked].id) {
+                        all_valid = false;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&v, t] {
+                for (int i = 0; i < PER_THREAD; ++i) {
+                    v.EmplaceBack(t * PER_THREAD + i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        reader.join();
+        assert(all_valid);
+        assert(v.Size() == NUM_THREADS * PER_THREAD);
+    }
+}
+
+namespace {
+
+    //        
+    struct ParallelObj {
+        ParallelObj() {
+            ++num_alive;
+        }
+        ParallelObj(const ParallelObj& other)
+            : id(other.id) {
+            if (other.throw_on_copy) {
+                throw std::runtime_error("Oops");
+            }
+            ++num_alive;
+        }
+        ParallelObj(ParallelObj&& other) noexcept
+            : id(other.id) {
+            ++num_alive;
+        }
+        ParallelObj& operator=(const ParallelObj&) = default;
+        ParallelObj& operator=(ParallelObj&&) = default;
+        ~ParallelObj() {
+            --num_alive;
+        }
+
+        int id = 0;
+        bool throw_on_copy = false;
+
+        static inline std::atomic<int> num_alive = 0;
+    };
+
+}  // namespace
+
+void Test17() {
+    const size_t SIZE = 10'000;
+    ParallelPolicy policy;
+    policy.num_threads = 4;
+    policy.min_elements_per_thread = 100;
+    {
+        Vector<ParallelObj> v(SIZE, policy);
+        assert(v.Size() == SIZE);
+        assert(ParallelObj::num_alive == static_cast<int>(SIZE));
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i].id = static_cast<int>(i);
+        }
+
+        Vector<ParallelObj> v_copy(v, policy);
+        assert(v_copy.Size() == SIZE && v_copy[SIZE - 1].id == static_cast<int>(SIZE) - 1);
+        assert(ParallelObj::num_alive == static_cast<int>(SIZE * 2));
+
+        v_copy.Reserve(SIZE * 2, policy);
+        assert(v_copy.Capacity() == SIZE * 2);
+        assert(v_copy[SIZE / 2].id == static_cast<int>(SIZE / 2));
+        assert(ParallelObj::num_alive == static_cast<int>(SIZE * 2));
+
+        //       ,  
+        v[SIZE / 3].throw_on_copy = true;
+        try {
+            Vector<ParallelObj> failed_copy(v, policy);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        try {
+            v_copy.Assign(v, policy);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        assert(v_copy.Size() == SIZE);
+        assert(ParallelObj::num_alive == static_cast<int>(SIZE * 2));
+
+        v[SIZE / 3].throw_on_copy = false;
+        v[0].id = -1;
+        v_copy.Assign(v, policy);
+        assert(v_copy[0].id == -1);
+        v_copy.Clear(policy);
+        assert(v_copy.Size() == 0);
+        assert(ParallelObj::num_alive == static_cast<int>(SIZE));
+    }
+    assert(ParallelObj::num_alive == 0);
+    {
+        Vector<int> v(SIZE, policy);
+        v[SIZE - 1] = 42;
+        v.Reserve(SIZE * 2, policy);
+        Vector<int> v_copy(v, policy);
+        assert(v_copy[0] == 0 && v_copy[SIZE - 1] == 42);
+    }
+}
+
+void Test18() {
+    HugePageOptions options;
+    options.threshold = size_t{ 1 } << 20;
+    options.numa_policy = NumaPolicy::PREFERRED;
+    options.numa_nodes = 1;
+    HugePageResource resource(options);
+    {
+        pmr::Vector<float> small(&resource);
+        small.Resize(16);
+        assert(resource.GetAllocationInfo(small.begin()).backing == MemoryBacking::UPSTREAM);
+
+        const size_t SIZE = size_t{ 3 } << 20;
+        pmr::Vector<float> large(SIZE, &resource);
+        const auto info = resource.GetAllocationInfo(large.begin());
+        assert(info.backing != MemoryBacking::UPSTREAM);
+        assert(reinterpret_cast<uintptr_t>(large.begin()) % HugePageResource::HUGE_PAGE_SIZE == 0);
+        large[SIZE - 1] = 1.0f;
+        large.Reserve(SIZE * 2);
+        assert(large[SIZE - 1] == 1.0f && large[0] == 0.0f);
+        assert(resource.GetAllocationInfo(large.begin()).backing != MemoryBacking::UPSTREAM);
+    }
+}
+
+void Test19() {
+    const size_t ALIGNMENT = 64;
+    {
+        AlignedVector<float, ALIGNMENT> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(static_cast<float>(i));
+            assert(reinterpret_cast<uintptr_t>(v.begin()) % ALIGNMENT == 0);
+            assert(v.Capacity() * sizeof(float) % ALIGNMENT == 0);
+        }
+        v.Reserve(1001);
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % ALIGNMENT == 0);
+        assert(v[999] == 999.0f);
+
+        AlignedVector<float, ALIGNMENT> v_copy(v);
+        assert(reinterpret_cast<uintptr_t>(v_copy.begin()) % ALIGNMENT == 0);
+    }
+    {
+        struct alignas(128) Wide {
+            int value = 0;
+        };
+        Vector<Wide> v(3);
+        v.EmplaceBack();
+        assert(reinterpret_cast<uintptr_t>(v.begin()) % alignof(Wide) == 0);
+    }
+}
+
+void Test20() {
+#ifdef __linux__
+    struct Record {
+        uint64_t key;
+        double value;
+    };
+    const auto path = std::filesystem::temp_directory_path() / "advanced_vector_mapped_test.bin";
+    std::filesystem::remove(path);
+    const int SIZE = 10'000;
+    {
+        MappedVector<Record> v(path.string());
+        assert(v.Size() == 0);
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(Record{ static_cast<uint64_t>(i), i * 0.5 });
+        }
+        v.EmplaceBack(v[0]);
+        assert(v.Size() == SIZE + 1);
+        assert(v[SIZE].key == 0);
+        v.PopBack();
+        v.Sync();
+    }
+    {
+        MappedVector<Record> v(path.string());
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() >= SIZE);
+        assert(v[SIZE - 1].key == SIZE - 1 && v[SIZE - 1].value == (SIZE - 1) * 0.5);
+        v.Resize(SIZE + 10);
+        assert(v[SIZE + 9].key == 0);
+        v.Flush();
+
+        //        
+        MappedVector<Record> moved(std::move(v));
+        assert(moved.Size() == SIZE + 10);
+        assert(v.Size() == 0 && v.Capacity() == 0 && v.begin() == v.end());
+        v.Clear();
+        v.Flush();
+        v.Sync();
+        try {
+            moved.Reserve(SIZE_MAX / 2);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::length_error&) {
+        }
+        assert(moved.Size() == SIZE + 10);
+    }
+    try {
+        MappedVector<uint32_t> wrong_type(path.string());
+        assert(false && "Exception is expected");
+    }
+    catch (const std::runtime_error&) {
+    }
+    std::filesystem::remove(path);
+    {
+        struct Tagged {
+            uint32_t tag = 7;
+        };
+        MappedVector<Tagged> v(path.string());
+        v.PushBack(Tagged{ 1 });
+        v.PushBack(Tagged{ 2 });
+        v.PopBack();
+        //     Tagged(),       
+        v.Resize(3);
+        assert(v[0].tag == 1 && v[1].tag == 7 && v[2].tag == 7);
+    }
+    std::filesystem::remove(path);
+#endif
+}
+
+void Test21() {
+    {
+        Vector<int> v{ 1, 2, 3, 4, 5 };
+        VectorView view(v);
+        assert(view.Size() == 5 && view.begin() == v.begin());
+        view[0] = 10;
+        assert(v[0] == 10);
+        const auto& cv = v;
+        VectorView<const int> const_view = cv;
+        assert(const_view.Subview(1, 3).Size() == 3 && const_view.Subview(1, 3)[2] == 4);
+        VectorView<const int> from_mutable = view;
+        assert(from_mutable.GetAddress() == v.begin());
+
+        SmallVector<int, 4> small;
+        small.PushBack(7);
+        assert(VectorView<int>(small)[0] == 7);
+    }
+#ifdef __linux__
+    {
+        const auto path = std::filesystem::temp_directory_path() / "advanced_vector_serialization_test.bin";
+        const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        assert(fd >= 0);
+        const size_t SIZE = 100'000;
+        Vector<double> v(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i] = i * 0.25;
+        }
+        WriteVector(fd, v);
+        WriteVector(fd, Vector<double>{});
+        WriteVector(fd, v);
+
+        lseek(fd, 0, SEEK_SET);
+        Vector<double> restored{ 1.0 };
+        ReadVector(fd, restored);
+        assert(restored.Size() == SIZE && restored[SIZE - 1] == (SIZE - 1) * 0.25);
+        ReadVector(fd, restored);
+        assert(restored.Size() == 0);
+        try {
+            Vector<float> wrong_type;
+            ReadVector(fd, wrong_type);
+            assert(false && "Exception is expected");
+        }
+        catch (const std::runtime_error&) {
+        }
+        close(fd);
+        std::filesystem::remove(path);
+    }
+#endif
+}
+
+namespace {
+
+    //   ,     
+    struct CopyOnlyObj {
+        explicit CopyOnlyObj(int id)
+            : id(id) {
+            ++alive;
+        }
+        CopyOnlyObj(const CopyOnlyObj& other)
+            : id(other.id) {
+            if (other.throw_on_copy) {
+                throw std::runtime_error("Oops");
+            }
+            ++alive;
+        }
+        ~CopyOnlyObj() {
+            --alive;
+        }
+        int id;
+        bool throw_on_copy = false;
+        static inline int alive = 0;
+    };
+
+}  // namespace
+
+void Test22() {
+    {
+        SoAVector<int, double, std::string> v;
+        for (int i = 0; i < 100; ++i) {
+            v.EmplaceBack(i, i * 0.5, std::to_string(i));
+        }
+        assert(v.Size() == 100 && v.Capacity() >= 100);
+        auto [id, weight, name] = v[42];
+        assert(id == 42 && weight == 21.0 && name == "42");
+        id = -1;
+        assert(v.Get<0>(42) == -1);
+
+        auto ids = v.Column<0>();
+        assert(ids.Size() == 100 && ids[99] == 99);
+        double sum = 0;
+        for (double w : v.Column<1>()) {
+            sum += w;
+        }
+        assert(sum == 2475.0);
+
+        v.Erase(10, 20);
+        assert(v.Size() == 90 && v.Get<0>(10) == 20 && v.Get<2>(10) == "20");
+        v.Erase(0);
+        assert(v.Get<0>(0) == 1);
+
+        //       
+        v.Reserve(v.Size());
+        v.EmplaceBack(v.Get<0>(0), v.Get<1>(0), v.Get<2>(0));
+        assert(v.Get<2>(v.Size() - 1) == "1");
+
+        const auto copy = v;
+        assert(copy.Size() == v.Size() && std::get<2>(copy[5]) == v.Get<2>(5));
+
+        v.Resize(3);
+        assert(v.Size() == 3 && v.Get<2>(2) == "3");
+        v.Resize(5);
+        assert(v.Get<0>(4) == 0 && v.Get<2>(4).empty());
+        v.PopBack();
+        v.Clear();
+        assert(v.Size() == 0 && copy.Size() == 90);
+    }
+    {
+        //       .     
+        {
+            SoAVector<std::unique_ptr<int>, CopyOnlyObj> v;
+            v.Reserve(2);
+            v.EmplaceBack(std::make_unique<int>(1), 1);
+            v.EmplaceBack(std::make_unique<int>(2), 2);
+            v.Get<1>(1).throw_on_copy = true;
+            try {
+                v.EmplaceBack(std::make_unique<int>(3), 3);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(v.Size() == 2 && v.Capacity() == 2);
+            assert(*v.Get<0>(0) == 1 && *v.Get<0>(1) == 2 && v.Get<1>(1).id == 2);
+            assert(CopyOnlyObj::alive == 2);
+        }
+        assert(CopyOnlyObj::alive == 0);
+    }
+}
+
+void Test23() {
+    using namespace std::literals;
+    {
+        SegmentedVector<std::string, 16> v;
+        v.PushBack("first"s);
+        std::string* first = &v[0];
+        for (int i = 1; i < 1000; ++i) {
+            v.EmplaceBack(std::to_string(i));
+        }
+        //    
+        assert(first == &v[0] && *first == "first");
+        assert(v.Size() == 1000 && v.Capacity() == 1008 && v.SegmentCount() == 63);
+        assert(v[999] == "999" && v.Segment(62).Size() == 8 && v.Segment(62)[7] == "999");
+
+        //       
+        while (v.Size() < v.Capacity()) {
+            v.EmplaceBack("x"s);
+        }
+        v.EmplaceBack(v[0]);
+        assert(v[v.Size() - 1] == "first");
+
+        assert(std::count(v.begin(), v.end(), "x"s) == 8);
+        assert(std::find(v.begin(), v.end(), "500"s) - v.begin() == 500);
+
+        const auto copy = v;
+        assert(copy.Size() == v.Size() && copy[500] == "500" && &copy[0] != &v[0]);
+        assert(std::equal(copy.begin(), copy.end(), v.cbegin()));
+
+        auto moved = std::move(v);
+        assert(moved.Size() == 1009 && &moved[0] == first && v.Size() == 0);
+
+        moved.Clear();
+        assert(moved.Size() == 0 && moved.Capacity() == 1024);
+        moved.ShrinkToFit();
+        assert(moved.Capacity() == 0);
+    }
+    {
+        SegmentedVector<int, 4> v;
+        v.Reserve(10);
+        assert(v.Capacity() == 12);
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(10 - i);
+        }
+        std::sort(v.begin(), v.end());
+        assert(std::is_sorted(v.begin(), v.end()) && v[0] == 1 && v[9] == 10);
+    }
+}
+
+void Test24() {
+    using namespace std::literals;
+    {
+        CowVector<std::string> v{ "a", "b", "c" };
+        const CowVector<std::string> snapshot = v;
+        //   
+        assert(snapshot.begin() == std::as_const(v).begin() && v.IsShared() && snapshot.IsShared());
+
+        v[0] = "changed";
+        assert(!v.IsShared() && !snapshot.IsShared());
+        assert(snapshot[0] == "a" && v[0] == "changed" && v[1] == "b");
+
+        auto copy = snapshot;
+        copy.EmplaceBack(copy[2]);
+        assert(copy.Size() == 4 && copy[3] == "c" && snapshot.Size() == 3);
+
+        copy.Erase(0);
+        assert(copy.Size() == 3 && copy[0] == "b" && snapshot[0] == "a");
+
+        auto another = snapshot;
+        another.Clear();
+        assert(another.Size() == 0 && snapshot.Size() == 3 && !snapshot.IsShared());
+        another.PushBack("x"s);
+        assert(another.Size() == 1 && another.View()[0] == "x");
+    }
+    {
+        //   ,   ,    
+        CowVector<int> v{ 1, 2, 3 };
+        int& first = v[0];
+        int* data = v.begin();
+        const CowVector<int> snapshot = v;
+        assert(!v.IsShared() && snapshot.begin() != std::as_const(v).begin());
+        first = 10;
+        data[1] = 20;
+        assert(snapshot[0] == 1 && snapshot[1] == 2 && v[0] == 10 && v[1] == 20);
+
+        v.Mutable().PushBack(4);
+        const CowVector<int> after_mutable = v;
+        assert(!v.IsShared() && after_mutable.Size() == 4);
+
+        //        
+        v.PopBack();
+        const CowVector<int> shared = v;
+        assert(v.IsShared() && shared.begin() == std::as_const(v).begin());
+    }
+    {
+        //        
+        Obj::ResetCounters();
+        {
+            Vector<Obj> data(3);
+            data[2].throw_on_copy = true;
+            CowVector<Obj> v(std::move(data));
+            const auto snapshot = v;
+            try {
+                v.EmplaceBack(1);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(v.IsShared() && v.Size() == 3 && Obj::GetAliveObjectCount() == 3);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //   ,     
+        const size_t SIZE = 1000;
+        auto table = CowVector<int>(Vector<int>(SIZE));
+        std::atomic<bool> done = false;
+        std::mutex mutex;
+        auto reader = [&] {
+            while (!done.load()) {
+                CowVector<int> snapshot;
+                {
+                    std::lock_guard guard(mutex);
+                    snapshot = table;
+                }
+                const int first = snapshot[0];
+                assert(std::all_of(snapshot.begin(), snapshot.end(), [first](int x) { return x == first; }));
+            }
+        };
+        std::thread readers[] = { std::thread(reader), std::thread(reader) };
+        for (int version = 1; version <= 100; ++version) {
+            CowVector<int> next;
+            {
+                std::lock_guard guard(mutex);
+                next = table;
+            }
+            std::fill(next.begin(), next.end(), version);
+            std::lock_guard guard(mutex);
+            table = std::move(next);
+        }
+        done = true;
+        for (auto& thread : readers) {
+            thread.join();
+        }
+        assert(std::as_const(table)[SIZE - 1] == 100);
+    }
+}
+
+namespace {
+
+    // ,    budget  
+    template <typename T>
+    struct LimitedAllocator {
+        using value_type = T;
+
+        LimitedAllocator() = default;
+        template <typename U>
+        LimitedAllocator(const LimitedAllocator<U>&) noexcept {
+        }
+
+        T* allocate(size_t n) {
+            if (n > budget) {
+                throw std::bad_alloc();
+            }
+            budget -= n;
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T* p, size_t n) noexcept {
+            budget += n;
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const LimitedAllocator<U>&) const noexcept {
+            return true;
+        }
+        template <typename U>
+        bool operator!=(const LimitedAllocator<U>&) const noexcept {
+            return false;
+        }
+
+        static inline size_t budget = 0;
+    };
+
+}  // namespace
+
+void Test25() {
+    {
+        LimitedAllocator<std::string>::budget = 12;
+        Vector<std::string, LimitedAllocator<std::string>> v;
+        assert(v.TryReserve(4) && v.Capacity() == 4);
+        assert(!v.TryReserve(16) && v.Capacity() == 4);
+        std::string* last = nullptr;
+        for (int i = 0; i < 4; ++i) {
+            last = v.TryEmplaceBack(std::to_string(i));
+            assert(last != nullptr && *last == std::to_string(i));
+        }
+        //    8     ,   16  
+        assert(v.TryEmplaceBack(v[0]) != nullptr && v.Capacity() == 8 && v[4] == "0");
+        while (v.Size() < v.Capacity()) {
+            assert(v.TryEmplaceBack("x") != nullptr);
+        }
+        assert(v.TryEmplaceBack(v[0]) == nullptr);
+        assert(v.Size() == 8 && v.Capacity() == 8 && v[0] == "0" && v[7] == "x");
+    }
+    {
+        // ,      ,    
+        Vector<int> v{ 1, 2, 3 };
+        assert(!v.TryReserve(std::numeric_limits<size_t>::max()));
+        assert(v.Size() == 3 && v.Capacity() == 3 && v[2] == 3);
+        assert(v.TryReserve(10) && v.Capacity() == 10 && v[2] == 3);
+
+        Vector<int, MallocAllocator<int>> malloc_vector;
+        assert(!malloc_vector.TryReserve(std::numeric_limits<size_t>::max()) && malloc_vector.Capacity() == 0);
+        assert(malloc_vector.TryEmplaceBack(5) != nullptr && malloc_vector[0] == 5);
+    }
+}
+
+void Test26() {
+    {
+        StaticVector<std::string, 4> v{ "a", "c" };
+        v.Insert(v.begin() + 1, "b");
+        v.EmplaceBack(v[0]);
+        assert(v.Size() == 4 && v.Capacity() == 4 && v[1] == "b" && v[3] == "a");
+        assert(v.TryEmplaceBack("x") == nullptr);
+        try {
+            v.PushBack("x");
+            assert(false && "Exception is expected");
+        }
+        catch (const std::length_error&) {
+        }
+        assert(v.Size() == 4);
+
+        v.Erase(v.begin());
+        assert(v.Size() == 3 && v[0] == "b");
+        v.Erase(v.begin() + 1, v.end());
+        assert(v.Size() == 1 && v[0] == "b");
+
+        StaticVector<std::string, 4> other{ "x", "y", "z" };
+        v.Swap(other);
+        assert(v.Size() == 3 && v[2] == "z" && other.Size() == 1 && other[0] == "b");
+        other = v;
+        assert(other.Size() == 3 && other[1] == "y");
+        StaticVector<std::string, 4> moved(std::move(other));
+        assert(moved.Size() == 3 && other.Size() == 0);
+        other = std::move(moved);
+        assert(other.Size() == 3 && moved.Size() == 0);
+        other.Resize(1);
+        assert(other.Size() == 1 && other[0] == "x");
+        //       
+        static_assert(sizeof(StaticVector<int, 8>) >= 8 * sizeof(int));
+    }
+    {
+        //      
+        Vector<int> scratch;
+        scratch.Reserve(100);
+        const int* buffer = scratch.begin();
+        for (int frame = 0; frame < 3; ++frame) {
+            Vector<int> result(10 + frame);
+            result[0] = frame;
+            scratch.AssignKeepCapacity(std::move(result));
+            assert(scratch.begin() == buffer && scratch.Capacity() == 100);
+            assert(scratch.Size() == static_cast<size_t>(10 + frame) && scratch[0] == frame);
+            assert(result.Size() == 0);
+        }
+        Vector<int> large(200);
+        scratch.AssignKeepCapacity(std::move(large));
+        assert(scratch.Size() == 200 && large.Size() == 0 && large.Capacity() == 100);
+    }
+    {
+        Obj::ResetCounters();
+        {
+            Vector<Obj> v(5);
+            Vector<Obj> rhs;
+            rhs.Reserve(3);
+            rhs.EmplaceBack(1);
+            rhs.EmplaceBack(2);
+            v.AssignKeepCapacity(std::move(rhs));
+            assert(v.Size() == 2 && v.Capacity() == 5 && v[1].id == 2);
+            assert(Obj::GetAliveObjectCount() == 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test27() {
+    //         
+    //  ,    
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int32_t> values(-50, 50);
+    const simd::Isa isas[] = { simd::Isa::SCALAR, simd::Isa::SSE2, simd::Isa::AVX2, simd::Isa::AVX512 };
+    for (simd::Isa isa : isas) {
+        if (isa > simd::DetectIsa()) {
+            continue;
+        }
+        simd::LimitIsa(isa);
+        assert(simd::GetIsa() == isa);
+        for (size_t size : { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33, 64, 100, 1000 }) {
+            Vector<int32_t> ints(size);
+            Vector<float> floats(size);
+            for (size_t i = 0; i < size; ++i) {
+                ints[i] = values(random);
+                floats[i] = static_cast<float>(ints[i]) * 0.5f;
+            }
+            for (int32_t value : { -50, 0, 7, 51 }) {
+                assert(simd::Find(ints, value) == std::find(ints.begin(), ints.end(), value));
+                assert(simd::Count(ints, value) == static_cast<size_t>(std::count(ints.begin(), ints.end(), value)));
+                const float float_value = static_cast<float>(value) * 0.5f;
+                assert(simd::Find(floats, float_value) == std::find(floats.begin(), floats.end(), float_value));
+                assert(simd::Count(floats, float_value)
+                    == static_cast<size_t>(std::count(floats.begin(), floats.end(), float_value)));
+            }
+            assert(simd::Sum(ints) == std::accumulate(ints.begin(), ints.end(), int64_t{ 0 }));
+            //     float 
+            assert(simd::Sum(floats) == std::accumulate(floats.begin(), floats.end(), 0.0f));
+            if (size > 0) {
+                assert(simd::Min(ints) == *std::min_element(ints.begin(), ints.end()));
+                assert(simd::Max(ints) == *std::max_element(ints.begin(), ints.end()));
+                assert(simd::Min(floats) == *std::min_element(floats.begin(), floats.end()));
+                assert(simd::Max(floats) == *std::max_element(floats.begin(), floats.end()));
+            }
+        }
+        //   
+        Vector<int32_t> large(1000);
+        simd::Fill(large, std::numeric_limits<int32_t>::max());
+        assert(simd::Sum(large) == int64_t{ 1000 } * std::numeric_limits<int32_t>::max());
+        assert(simd::Min(large) == std::numeric_limits<int32_t>::max());
+    }
+    simd::LimitIsa(simd::Isa::AVX512);
+    {
+        //      
+        Vector<std::string> strings{ "b", "a", "c" };
+        assert(simd::Find(strings, std::string("c")) == strings.begin() + 2);
+        assert(simd::Min(strings) == "a" && simd::Max(strings) == "c");
+        AlignedVector<int32_t, 64> aligned;
+        aligned.Resize(40);
+        simd::Fill(aligned, 3);
+        assert(simd::Count(aligned, 3) == 40 && simd::Sum(aligned) == 120);
+    }
+}
+
+void Test28() {
+    {
+        //    std::lower_bound    
+        std::mt19937 random(7);
+        for (int size = 0; size < 70; ++size) {
+            Vector<int> keys;
+            for (int i = 0; i < size; ++i) {
+                keys.PushBack(static_cast<int>(random() % 100));
+            }
+            FlatSet<int> set(std::move(keys));
+            assert(std::is_sorted(set.begin(), set.end()));
+            assert(std::adjacent_find(set.begin(), set.end()) == set.end());
+            for (int key = -1; key <= 100; ++key) {
+                assert(set.LowerBound(key) == std::lower_bound(set.begin(), set.end(), key));
+            }
+        }
+    }
+    {
+        FlatSet<std::string> set{ "b", "a", "c", "a" };
+        assert(set.Size() == 3 && *set.begin() == "a");
+        auto [it, inserted] = set.Insert("aa");
+        assert(inserted && *it == "aa" && it == set.begin() + 1);
+        assert(!set.Insert("c").second && set.Size() == 4);
+        assert(set.Contains("b") && !set.Contains("d"));
+        assert(set.Erase("b") == 1 && set.Erase("b") == 0 && !set.Contains("b"));
+    }
+    {
+        FlatMap<int, std::string> map{ { 3, "three" }, { 1, "one" }, { 3, "again" }, { 2, "two" } };
+        assert(map.Size() == 3);
+        //       
+        assert(*map.Find(3) == "three" && map.Find(4) == nullptr);
+        assert(map.Keys()[0] == 1 && map.Values()[0] == "one");
+
+        auto [value, inserted] = map.Emplace(0, 4, 'z');
+        assert(inserted && *value == "zzzz" && map.Keys()[0] == 0);
+        assert(!map.Emplace(0, "other").second && *map.Find(0) == "zzzz");
+
+        map[10] = "ten";
+        assert(map.Size() == 5 && map.Keys()[4] == 10 && map[10] == "ten");
+        assert(map.Erase(1) == 1 && !map.Contains(1) && map.Size() == 4);
+        const auto& const_map = map;
+        assert(*const_map.Find(2) == "two");
+    }
+    {
+        //         
+        Obj::ResetCounters();
+        {
+            FlatMap<int, Obj> map;
+            map.Emplace(1, 1);
+            Obj source(2);
+            source.throw_on_copy = true;
+            try {
+                map.Emplace(0, source);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(map.Size() == 1 && map.Values().Size() == 1 && !map.Contains(0));
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // operator[]  TryEmplace     
+        struct ById {
+            bool operator()(const Obj& lhs, const Obj& rhs) const {
+                return lhs.id < rhs.id;
+            }
+        };
+        Obj::ResetCounters();
+        {
+            FlatMap<Obj, int, ById> map;
+            const Obj key(5);
+            map[key] = 1;
+            assert(Obj::num_copied == 1);
+            map[key] += 1;
+            assert(!map.TryEmplace(key, 7).second && *map.Find(key) == 2);
+            assert(Obj::num_copied == 1);
+            assert(map.TryEmplace(Obj(6), 7).second && map.Size() == 2 && Obj::num_copied == 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test29() {
+    using namespace std::literals;
+    {
+        SpscRingBuffer<std::string> queue(3);
+        assert(queue.Capacity() == 4 && queue.Size() == 0);
+        std::string out;
+        assert(!queue.TryPop(out));
+        assert(queue.TryPush("a"s) && queue.TryEmplace(2, 'b'));
+        assert(queue.TryPop(out) && out == "a");
+
+        //          
+        std::string items[] = { "c", "d", "e", "f" };
+        assert(queue.PushN(items, 4) == 3 && queue.Size() == 4);
+        assert(!queue.TryPush("g"s));
+        std::string popped[5];
+        assert(queue.PopN(popped, 5) == 4);
+        assert(popped[0] == "bb" && popped[1] == "c" && popped[3] == "e" && queue.Size() == 0);
+    }
+    {
+        MpmcRingBuffer<int> queue(1);
+        assert(queue.Capacity() == 2);
+        int items[] = { 1, 2, 3 };
+        assert(queue.PushN(items, 3) == 2 && !queue.TryPush(4));
+        int out = 0;
+        assert(queue.TryPop(out) && out == 1);
+        assert(queue.TryPush(4));
+        int popped[3] = {};
+        assert(queue.PopN(popped, 3) == 2 && popped[0] == 2 && popped[1] == 4);
+        assert(!queue.TryPop(out));
+    }
+    {
+        //        
+        Obj::ResetCounters();
+        {
+            SpscRingBuffer<Obj> spsc(4);
+            MpmcRingBuffer<Obj> mpmc(4);
+            for (int i = 0; i < 6; ++i) {
+                spsc.TryEmplace(i);
+                mpmc.TryEmplace(i);
+            }
+            Obj out;
+            assert(spsc.TryPop(out) && out.id == 0 && mpmc.TryPop(out) && out.id == 0);
+            assert(Obj::GetAliveObjectCount() == 7);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        //       .   ,
+        //     ,       
+        const int COUNT = 10000;
+        SpscRingBuffer<int> queue(64);
+        std::thread producer([&queue] {
+            int batch[7];
+            for (int next = 0; next < COUNT;) {
+                const int size = std::min(7, COUNT - next);
+                std::iota(batch, batch + size, next);
+                const size_t pushed = queue.PushN(batch, size);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                next += static_cast<int>(pushed);
+            }
+        });
+        int expected = 0;
+        int batch[5];
+        while (expected < COUNT) {
+            const size_t size = queue.PopN(batch, 5);
+            if (size == 0) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < size; ++i) {
+                assert(batch[i] == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+        assert(queue.Size() == 0);
+    }
+    {
+        //  ,   ,    
+        const int THREADS = 4;
+        const int PER_THREAD = 2000;
+        MpmcRingBuffer<int> queue(32);
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> popped{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&queue, t] {
+                for (int i = 0; i < PER_THREAD;) {
+                    int batch[3] = { t * PER_THREAD + i, t * PER_THREAD + i + 1, t * PER_THREAD + i + 2 };
+                    const size_t pushed = queue.PushN(batch, std::min(3, PER_THREAD - i));
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    i += static_cast<int>(pushed);
+                }
+            });
+            threads.emplace_back([&queue, &sum, &popped] {
+                int batch[4];
+                while (popped.load() < THREADS * PER_THREAD) {
+                    const size_t size = queue.PopN(batch, 4);
+                    if (size == 0) {
+                        std::this_thread::yield();
+                    }
+                    for (size_t i = 0; i < size; ++i) {
+                        sum += batch[i];
+                    }
+                    popped += static_cast<int>(size);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const long long total = static_cast<long long>(THREADS) * PER_THREAD;
+        assert(popped == total && sum == total * (total - 1) / 2 && queue.Size() == 0);
+    }
+}
+
+void Test30() {
+    using namespace std::literals;
+    {
+        DevVector<std::string> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(std::to_string(i));
+            v.EmplaceFront(1, static_cast<char>('a' + i));
+        }
+        assert(v.Size() == 20 && v[0] == "j" && v[9] == "a" && v[10] == "0" && v[19] == "9");
+
+        //        ,      
+        const std::string* last = &v[19];
+        v.Emplace(v.begin() + 2, "front"s);
+        assert(&v[20] == last && v[2] == "front" && v[3] == "h");
+        const std::string* first = &v[0];
+        v.Insert(v.end() - 2, "back"s);
+        assert(&v[0] == first && v[19] == "back" && v[21] == "9");
+        last = &v[21];
+        v.Erase(v.begin() + 1);
+        assert(&v[20] == last && v[0] == "j" && v[1] == "front");
+        first = &v[0];
+        v.Erase(v.end() - 3, v.end() - 1);
+        assert(&v[0] == first && v.Size() == 19 && v[18] == "9" && v[17] == "7");
+
+        v.PopFront();
+        v.PopBack();
+        assert(v.Size() == 17 && v[0] == "front" && v[16] == "7");
+        VectorView<const std::string> view(std::as_const(v));
+        assert(view.Size() == 17 && view[1] == "h");
+
+        DevVector<std::string> copy = v;
+        v.Clear();
+        assert(v.Size() == 0 && v.FrontSpace() == v.Capacity() / 2);
+        assert(copy.Size() == 17 && copy[0] == "front");
+    }
+    {
+        //  :          
+        DevVector<int> window;
+        for (int i = 0; i < 8; ++i) {
+            window.PushBack(i);
+        }
+        const size_t capacity = window.Capacity();
+        for (int i = 8; i < 10000; ++i) {
+            window.PopFront();
+            window.PushBack(i);
+            assert(window.Size() == 8 && window[0] == i - 7 && window[7] == i);
+        }
+        assert(window.Capacity() == capacity);
+    }
+    {
+        //           
+        using Allocator = CountingAllocator<std::string>;
+        DevVector<std::string, Allocator> window;
+        for (int i = 0; i < 8; ++i) {
+            window.PushBack(std::string(32, static_cast<char>('a' + i)));
+        }
+        Allocator::ResetCounters();
+        for (int i = 8; i < 1000; ++i) {
+            window.PopFront();
+            window.PushBack(std::string(32, static_cast<char>('a' + i % 26)));
+            assert(window.Size() == 8 && window[7][0] == 'a' + i % 26);
+        }
+        assert(Allocator::num_allocations == 0);
+    }
+    {
+        DevVector<int> v{ 1, 2, 3 };
+        const int& front = v[0];
+        v.EmplaceFront(front);
+        v.EmplaceBack(v[3]);
+        assert(v.Size() == 5 && v[0] == 1 && v[4] == 3);
+        v.Resize(7);
+        assert(v.Size() == 7 && v[6] == 0);
+        v.Reserve(100);
+        assert(v.Capacity() >= 100 && v[0] == 1 && v.BackSpace() >= 93);
+    }
+    {
+        //      
+        Obj::ResetCounters();
+        {
+            DevVector<Obj> v(2);
+            v.Reserve(2);
+            Obj source(5);
+            source.throw_on_copy = true;
+            try {
+                v.EmplaceFront(source);
+                assert(false && "Exception is expected");
+            }
+            catch (const std::runtime_error&) {
+            }
+            assert(v.Size() == 2 && v.Capacity() == 2);
+            v.PushFront(Obj(7));
+            v.Emplace(v.begin() + 1, 8);
+            assert(v.Size() == 4 && v[0].id == 7 && v[1].id == 8);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test31() {
+    // ,  ,    
+    struct Tracked {
+        explicit Tracked(std::thread::id* destroyed_on = nullptr)
+            : destroyed_on(destroyed_on) {
+        }
+        Tracked(Tracked&& other) noexcept
+            : destroyed_on(std::exchange(other.destroyed_on, nullptr)) {
+        }
+        Tracked& operator=(Tracked&& other) noexcept {
+            std::swap(destroyed_on, other.destroyed_on);
+            return *this;
+        }
+        ~Tracked() {
+            if (destroyed_on != nullptr) {
+                *destroyed_on = std::this_thread::get_id();
+            }
+        }
+
+        std::thread::id* destroyed_on;
+    };
+
+    BackgroundReclaimer reclaimer;
+    {
+        std::thread::id ids[4];
+        Vector<Tracked> v;
+        for (auto& id : ids) {
+            v.EmplaceBack(&id);
+        }
+        v.Resize(2, reclaimer);
+        assert(v.Size() == 2 && v[1].destroyed_on == &ids[1]);
+        reclaimer.Flush();
+        assert(ids[2] != std::thread::id() && ids[2] != std::this_thread::get_id() && ids[3] == ids[2]);
+
+        Vector<Tracked> other;
+        other.EmplaceBack(nullptr);
+        v.Assign(std::move(other), reclaimer);
+        assert(v.Size() == 1 && v[0].destroyed_on == nullptr && other.Size() == 0);
+        reclaimer.Flush();
+        assert(ids[0] == ids[2] && ids[1] == ids[2]);
+
+        v.ClearAndRelease(reclaimer);
+        assert(v.Size() == 0 && v.Capacity() == 0);
+        v.EmplaceBack(&ids[0]);
+        assert(ids[0] == ids[2]);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(100);
+        v.Resize(10, reclaimer);
+        v.ClearAndRelease(reclaimer);
+        reclaimer.Flush();
+        assert(Obj::GetAliveObjectCount() == 0);
+
+        //     
+        Vector<int> ints(10);
+        ints.Resize(5, reclaimer);
+        ints.ClearAndRelease(reclaimer);
+        assert(ints.Size() == 0 && ints.Capacity() == 0);
+    }
+}
+
+void Test32() {
+    {
+        BitVector bits;
+        bits.Reserve(100);
+        assert(bits.Size() == 0 && bits.Capacity() >= 100 && bits.FindFirst() == 0);
+        for (int i = 0; i < 70; ++i) {
+            bits.PushBack(i % 3 == 0);
+        }
+        assert(bits.Size() == 70 && bits.Words().Size() == 2 && bits.Count() == 24);
+        assert(bits[0] && !bits[1] && bits[69] && bits.FindFirst(1) == 3 && bits.FindFirst(67) == 69);
+        bits.Resize(130, true);
+        assert(bits.Count() == 84 && bits[129] && bits.FindFirst(70) == 70);
+        bits.Resize(65);
+        //    :      
+        bits.Resize(128);
+        assert(bits.Count() == 22 && !bits[70] && bits.FindFirst(64) == 128);
+        bits.PopBack();
+        bits.Flip(100);
+        bits.Reset(0);
+        assert(bits.Size() == 127 && bits[100] && !bits[0] && bits.FindFirst() == 3);
+
+        const BitVector copy = bits;
+        bits.Clear();
+        assert(bits.Size() == 0 && copy.Size() == 127 && copy != bits);
+        assert(BitVector({ true, false, true }) == BitVector({ true, false, true }));
+    }
+    {
+        //      std::vector<bool>
+        std::mt19937 random(3);
+        for (size_t size : { 1, 63, 64, 65, 200, 1000 }) {
+            BitVector lhs(size);
+            BitVector rhs(size);
+            std::vector<bool> expected_lhs(size);
+            std::vector<bool> expected_rhs(size);
+            for (size_t i = 0; i < size; ++i) {
+                expected_lhs[i] = random() % 2 == 0;
+                expected_rhs[i] = random() % 2 == 0;
+                lhs.Set(i, expected_lhs[i]);
+                rhs.Set(i, expected_rhs[i]);
+            }
+            for (int round = 0; round < 30; ++round) {
+                size_t first = random() % (size + 1);
+                size_t last = random() % (size + 1);
+                if (first > last) {
+                    std::swap(first, last);
+                }
+                const int operation = round % 4;
+                for (size_t i = first; i < last; ++i) {
+                    const bool a = expected_lhs[i];
+                    const bool b = expected_rhs[i];
+                    expected_lhs[i] = operation == 0 ? a && b : operation == 1 ? a || b : operation == 2 ? a != b : false;
+                }
+                if (operation == 0) {
+                    lhs.And(rhs, first, last);
+                }
+                else if (operation == 1) {
+                    lhs.Or(rhs, first, last);
+                }
+                else if (operation == 2) {
+                    lhs.Xor(rhs, first, last);
+                }
+                else {
+                    lhs.Fill(first, last, false);
+                }
+                assert(lhs.Count() == static_cast<size_t>(std::count(expected_lhs.begin(), expected_lhs.end(), true)));
+                const size_t from = random() % (size + 1);
+                const auto found = std::find(expected_lhs.begin() + from, expected_lhs.end(), true);
+                assert(lhs.FindFirst(from) == static_cast<size_t>(found - expected_lhs.begin()));
+            }
+            lhs |= rhs;
+            lhs ^= rhs;
+            lhs &= rhs;
+            assert(lhs.Count() == 0);
+        }
+    }
+}
+
+void Test33() {
+    struct Point {
+        int x = 0;
+        int y = 0;
+    };
+    static constexpr auto SQUARES = MakeConstexprVector<uint32_t, 16>(10, [](size_t i) {
+        return static_cast<uint32_t>(i * i);
+    });
+    static_assert(SQUARES.Size() == 10 && SQUARES.Capacity() == 16);
+    static_assert(SQUARES[3] == 9 && SQUARES[9] == 81);
+
+    static constexpr ConstexprVector<Point, 4> POINTS = [] {
+        ConstexprVector<Point, 4> points{ { 1, 2 } };
+        points.EmplaceBack(Point{ 3, 4 });
+        points.PushBack(Point{ 5, 6 });
+        points.PopBack();
+        points.Resize(3);
+        return points;
+    }();
+    static_assert(POINTS.Size() == 3 && POINTS[1].y == 4 && POINTS[2].x == 0);
+
+    //        Vector  
+    const VectorView<const uint32_t> view(SQUARES);
+    assert(view.Size() == 10 && view.begin() == SQUARES.begin() && view[4] == 16);
+    const Vector<uint32_t> squares = SQUARES.ToVector();
+    assert(squares.Size() == 10 && std::equal(squares.begin(), squares.end(), SQUARES.begin()));
+
+    ConstexprVector<int, 2> runtime;
+    runtime.PushBack(1);
+    runtime.PushBack(2);
+    try {
+        runtime.PushBack(3);
+        assert(false && "Exception is expected");
+    }
+    catch (const std::length_error&) {
+    }
+    runtime.Clear();
+    assert(runtime.Size() == 0 && runtime.ToVector().Size() == 0);
+}
+
 int main() {
     try {
         Test1();
@@ -392,6 +2211,34 @@ int main() {
         Test3();
         Test4();
         Test5();
+        Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
+        Test32();
+        Test33();
     }
     catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,244 @@
+#pragma once
+#include "vector.cpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Вектор тривиально копируемых элементов, хранящийся в отображённом в память файле. Открытие
+// существующего файла сводится к mmap, а страницы подгружаются при первом обращении.
+// Рост выполняется через ftruncate и mremap. Файл начинается с заголовка, в котором записаны
+// размер элемента и количество элементов, данные следуют за ним. Перемещённый вектор не владеет
+// файлом: он пуст, имеет нулевую ёмкость, а Flush и Sync для него ничего не делают
+template <typename T, typename Growth = DoublingGrowth>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector stores elements as raw bytes");
+
+    struct Header {
+        uint64_t magic;
+        uint64_t element_size;
+        uint64_t size;
+    };
+
+    static constexpr uint64_t MAGIC = 0x524f5443'4556414dULL;  // "MAVECTOR"
+    // Смещение данных от начала файла; сохраняет выравнивание элементов по кэш-линии
+    static constexpr size_t DATA_OFFSET = 64;
+    static_assert(sizeof(Header) <= DATA_OFFSET && alignof(T) <= DATA_OFFSET);
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Открывает файл path, создавая его при отсутствии
+    explicit MappedVector(const std::string& path) {
+        fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "cannot open " + path);
+        }
+        try {
+            struct stat st {};
+            if (fstat(fd_, &st) != 0) {
+                throw std::system_error(errno, std::generic_category(), "cannot stat " + path);
+            }
+            const bool created = st.st_size == 0;
+            if (created) {
+                Truncate(DATA_OFFSET);
+                st.st_size = DATA_OFFSET;
+            }
+            else if (static_cast<size_t>(st.st_size) < DATA_OFFSET) {
+                throw std::runtime_error(path + " is not a MappedVector file");
+            }
+            length_ = static_cast<size_t>(st.st_size);
+            void* p = mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+            if (p == MAP_FAILED) {
+                throw std::system_error(errno, std::generic_category(), "cannot map " + path);
+            }
+            mapping_ = static_cast<char*>(p);
+            if (created) {
+                *GetHeader() = Header{ MAGIC, sizeof(T), 0 };
+            }
+            else if (GetHeader()->magic != MAGIC || GetHeader()->element_size != sizeof(T)
+                || GetHeader()->size > Capacity()) {
+                throw std::runtime_error(path + " does not hold a MappedVector of this element type");
+            }
+        }
+        catch (...) {
+            Close();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : fd_(std::exchange(other.fd_, -1))
+        , mapping_(std::exchange(other.mapping_, nullptr))
+        , length_(std::exchange(other.length_, 0)) {
+    }
+
+    MappedVector& operator=(MappedVector&& rhs) noexcept {
+        if (this != &rhs) {
+            Close();
+            fd_ = std::exchange(rhs.fd_, -1);
+            mapping_ = std::exchange(rhs.mapping_, nullptr);
+            length_ = std::exchange(rhs.length_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedVector() {
+        Close();
+    }
+
+    iterator begin() noexcept {
+        return mapping_ != nullptr ? reinterpret_cast<T*>(mapping_ + DATA_OFFSET) : nullptr;
+    }
+    iterator end() noexcept {
+        return begin() + Size();
+    }
+    const_iterator begin() const noexcept {
+        return const_cast<MappedVector&>(*this).begin();
+    }
+    const_iterator end() const noexcept {
+        return begin() + Size();
+    }
+
+    size_t Size() const noexcept {
+        return mapping_ != nullptr ? static_cast<size_t>(GetHeader()->size) : 0;
+    }
+
+    size_t Capacity() const noexcept {
+        return mapping_ != nullptr ? (length_ - DATA_OFFSET) / sizeof(T) : 0;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<MappedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < Size());
+        return begin()[index];
+    }
+
+    // Увеличивает файл так, чтобы он вмещал new_capacity элементов
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        if (new_capacity > (SIZE_MAX - DATA_OFFSET) / sizeof(T)) {
+            throw std::length_error("MappedVector capacity is too large");
+        }
+        const size_t new_length = DATA_OFFSET + new_capacity * sizeof(T);
+        Truncate(new_length);
+        void* p = mremap(mapping_, length_, new_length, MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) {
+            const int error = errno;
+            // Отображение не изменилось, возвращаем файлу прежний размер
+            (void)ftruncate(fd_, static_cast<off_t>(length_));
+            throw std::system_error(error, std::generic_category(), "cannot remap MappedVector");
+        }
+        mapping_ = static_cast<char*>(p);
+        length_ = new_length;
+    }
+
+    // Новые элементы инициализируются значением, как T()
+    void Resize(size_t new_size) {
+        const size_t size = Size();
+        if (new_size == size) {
+            return;
+        }
+        if (new_size > size) {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(begin() + size, new_size - size);
+        }
+        GetHeader()->size = new_size;
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        const size_t size = Size();
+        if (size == Capacity()) {
+            // Элемент создаётся заранее: после mremap ссылки из args на элементы вектора недействительны
+            const T value(std::forward<Args>(args)...);
+            Reserve(Growth::NextCapacity(Capacity(), size + 1, sizeof(T)));
+            std::memcpy(static_cast<void*>(begin() + size), &value, sizeof(T));
+        }
+        else {
+            new (begin() + size) T(std::forward<Args>(args)...);
+        }
+        GetHeader()->size = size + 1;
+        return begin()[size];
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    void PopBack() noexcept {
+        if (Size() > 0) {
+            --GetHeader()->size;
+        }
+    }
+
+    void Clear() noexcept {
+        if (mapping_ != nullptr) {
+            GetHeader()->size = 0;
+        }
+    }
+
+    // Начинает асинхронную запись изменённых страниц в файл
+    void Flush() {
+        if (mapping_ != nullptr && msync(mapping_, length_, MS_ASYNC) != 0) {
+            throw std::system_error(errno, std::generic_category(), "cannot flush MappedVector");
+        }
+    }
+
+    // Дожидается записи содержимого вектора на диск
+    void Sync() {
+        if (mapping_ != nullptr && (msync(mapping_, length_, MS_SYNC) != 0 || fsync(fd_) != 0)) {
+            throw std::system_error(errno, std::generic_category(), "cannot sync MappedVector");
+        }
+    }
+
+private:
+    Header* GetHeader() noexcept {
+        return reinterpret_cast<Header*>(mapping_);
+    }
+
+    const Header* GetHeader() const noexcept {
+        return reinterpret_cast<const Header*>(mapping_);
+    }
+
+    void Truncate(size_t length) {
+        if (ftruncate(fd_, static_cast<off_t>(length)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "cannot resize MappedVector file");
+        }
+    }
+
+    void Close() noexcept {
+        if (mapping_ != nullptr) {
+            munmap(mapping_, length_);
+            mapping_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    int fd_ = -1;
+    char* mapping_ = nullptr;
+    size_t length_ = 0;
+};
+
+#endif  // __linux__
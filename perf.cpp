@@ -0,0 +1,254 @@
+#ifndef ADVANCED_VECTOR_STATS
+#define ADVANCED_VECTOR_STATS
+#endif
+#include "vector.cpp"
+#include "test_objects.cpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Регрессионные проверки производительности: бюджеты выделений памяти и переносов элементов
+// для типовых сценариев по счётчикам stats и сравнение скорости Vector и std::vector.
+// Возвращает ненулевой код, если хотя бы одна проверка не прошла
+
+namespace {
+
+    int failures = 0;
+
+    void Check(bool condition, const std::string& what) {
+        if (!condition) {
+            ++failures;
+            std::cerr << "FAILED: " << what << std::endl;
+        }
+    }
+
+    // Перемещение бросает исключение, поэтому при росте вектор обязан копировать элементы
+    struct ThrowingMove {
+        ThrowingMove() = default;
+        ThrowingMove(const ThrowingMove&) = default;
+        ThrowingMove(ThrowingMove&& other) noexcept(false)
+            : value(std::move(other.value)) {
+        }
+        ThrowingMove& operator=(const ThrowingMove&) = default;
+
+        std::string value;
+    };
+
+    template <typename T>
+    stats::Counters& ResetCounters() {
+        stats::Counters& counters = stats::CountersFor<T>();
+        counters.Reset();
+        return counters;
+    }
+
+    size_t Reallocations(const stats::Counters& counters) {
+        return counters.emplace_back_reallocations + counters.emplace_reallocations + counters.insert_reallocations
+            + counters.reserve_reallocations + counters.shrink_reallocations;
+    }
+
+    // Количество буферов и перенесённых элементов при росте DoublingGrowth от пустого вектора до size
+    std::pair<size_t, size_t> ExpectedGrowth(size_t size) {
+        size_t buffers = 0;
+        size_t relocated = 0;
+        for (size_t capacity = 0; capacity < size; capacity = DoublingGrowth::NextCapacity(capacity, capacity + 1, 0)) {
+            ++buffers;
+            relocated += capacity;
+        }
+        return { buffers, relocated };
+    }
+
+    // N добавлений после Reserve(N) выделяют память один раз и ничего не переносят
+    template <typename T>
+    void CheckReservedPushBack(const char* name, size_t size) {
+        stats::Counters& counters = ResetCounters<T>();
+        {
+            Vector<T> v;
+            v.Reserve(size);
+            for (size_t i = 0; i < size; ++i) {
+                v.PushBack(T());
+            }
+        }
+        const std::string prefix = std::string(name) + " reserved push_back: ";
+        Check(counters.allocations == 1, prefix + "one allocation");
+        Check(counters.deallocations == 1, prefix + "one deallocation");
+        Check(Reallocations(counters) == 1 && counters.reserve_reallocations == 1, prefix + "only Reserve reallocates");
+        Check(counters.elements_moved + counters.elements_copied + counters.elements_relocated_bitwise == 0,
+            prefix + "no relocations");
+    }
+
+    // Рост без Reserve выделяет буферы по политике DoublingGrowth и переносит элементы способом,
+    // который выбирает InitOnConstruct: побайтово, перемещением или копированием
+    template <typename T>
+    void CheckGrowth(const char* name, size_t size) {
+        stats::Counters& counters = ResetCounters<T>();
+        {
+            Vector<T> v;
+            for (size_t i = 0; i < size; ++i) {
+                v.EmplaceBack();
+            }
+        }
+        const auto [buffers, relocated] = ExpectedGrowth(size);
+        const std::string prefix = std::string(name) + " growth: ";
+        Check(counters.allocations == buffers, prefix + "allocations follow DoublingGrowth");
+        Check(counters.emplace_back_reallocations == buffers, prefix + "every buffer is caused by EmplaceBack");
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            Check(counters.elements_relocated_bitwise == relocated, prefix + "trivially relocatable elements are copied bitwise");
+            Check(counters.elements_moved + counters.elements_copied == 0, prefix + "no element-wise relocations");
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            Check(counters.elements_moved == relocated, prefix + "nothrow-movable elements are moved");
+            Check(counters.elements_copied == 0, prefix + "nothrow-movable elements are never copied");
+        }
+        else {
+            Check(counters.elements_copied == relocated, prefix + "elements with throwing move are copied");
+            Check(counters.elements_moved == 0, prefix + "elements with throwing move are never moved");
+        }
+    }
+
+    // Копирование, вставка диапазона, Resize и переиспользование буфера выделяют не больше памяти,
+    // чем необходимо
+    void CheckBulkOperations(size_t size) {
+        stats::Counters& counters = ResetCounters<std::string>();
+        const Vector<std::string> source(size);
+        Check(counters.allocations == 1, "sized constructor allocates once");
+
+        counters.Reset();
+        const Vector<std::string> copy = source;
+        Check(counters.allocations == 1, "copy allocates once");
+
+        counters.Reset();
+        Vector<std::string> inserted;
+        inserted.Insert(inserted.end(), source.begin(), source.end());
+        Check(counters.allocations == 1 && counters.insert_reallocations == 1, "range insert allocates once");
+
+        counters.Reset();
+        Vector<std::string> resized;
+        resized.Resize(size);
+        resized.Resize(size / 2);
+        resized.Resize(size);
+        Check(counters.allocations == 1, "shrinking and regrowing within capacity does not allocate");
+
+        counters.Reset();
+        Vector<std::string> work(size);
+        for (int round = 0; round < 10; ++round) {
+            Vector<std::string> next(size / 2);
+            work.AssignKeepCapacity(std::move(next));
+        }
+        Check(counters.allocations == 11, "AssignKeepCapacity keeps the target buffer");
+    }
+
+    // Лучшее из нескольких измерений времени выполнения action, в наносекундах
+    template <typename Action>
+    double BestTime(Action action) {
+        const int RUNS = 7;
+        double best = 0;
+        for (int run = 0; run < RUNS; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            action();
+            const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    }
+
+    // Сравнивает скорость сценария для Vector и std::vector, собранных одинаково. Базовая линия —
+    // std::vector в том же запуске, поэтому проверка не зависит от машины. Проваливается, если
+    // Vector медленнее больше чем в max_slowdown раз
+    template <typename VectorAction, typename StdAction>
+    void CheckThroughput(const char* name, double max_slowdown, VectorAction vector_action, StdAction std_action) {
+        const double vector_time = BestTime(vector_action);
+        const double std_time = BestTime(std_action);
+        const double ratio = vector_time / std_time;
+        std::cout << name << ": Vector " << vector_time / 1e6 << " ms, std::vector " << std_time / 1e6
+            << " ms, ratio " << ratio << std::endl;
+        Check(ratio <= max_slowdown, std::string(name) + " throughput is within the baseline");
+    }
+
+    void CheckThroughputBaselines(double max_slowdown) {
+        const size_t SIZE = 1 << 18;
+        CheckThroughput("push_back int", max_slowdown, [SIZE] {
+            Vector<int> v;
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.PushBack(static_cast<int>(i));
+            }
+        }, [SIZE] {
+            std::vector<int> v;
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.push_back(static_cast<int>(i));
+            }
+        });
+        CheckThroughput("push_back string", max_slowdown, [SIZE] {
+            Vector<std::string> v;
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.PushBack(std::string(32, 'x'));
+            }
+        }, [SIZE] {
+            std::vector<std::string> v;
+            for (size_t i = 0; i < SIZE; ++i) {
+                v.push_back(std::string(32, 'x'));
+            }
+        });
+        Vector<std::string> vector_source(SIZE / 4);
+        std::fill(vector_source.begin(), vector_source.end(), std::string(32, 'x'));
+        const std::vector<std::string> std_source(vector_source.begin(), vector_source.end());
+        CheckThroughput("copy string", max_slowdown, [&vector_source] {
+            const Vector<std::string> copy = vector_source;
+        }, [&std_source] {
+            const std::vector<std::string> copy = std_source;
+        });
+        CheckThroughput("insert and erase in the middle", max_slowdown, [] {
+            Vector<int> v(4096);
+            for (int i = 0; i < 4096; ++i) {
+                v.Insert(v.begin() + v.Size() / 2, i);
+                v.Erase(v.begin() + v.Size() / 3);
+            }
+        }, [] {
+            std::vector<int> v(4096);
+            for (int i = 0; i < 4096; ++i) {
+                v.insert(v.begin() + v.size() / 2, i);
+                v.erase(v.begin() + v.size() / 3);
+            }
+        });
+    }
+
+}  // namespace
+
+// Параметры: --max-slowdown=X задаёт допустимое замедление относительно std::vector,
+// --no-timing отключает проверки скорости, например в сборках с санитайзерами
+int main(int argc, char* argv[]) {
+    double max_slowdown = 2.0;
+    bool timing = true;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--max-slowdown=", 15) == 0) {
+            max_slowdown = std::atof(argv[i] + 15);
+        }
+        else if (std::strcmp(argv[i], "--no-timing") == 0) {
+            timing = false;
+        }
+    }
+
+    const size_t SIZE = 1000;
+    CheckReservedPushBack<int>("int", SIZE);
+    CheckReservedPushBack<std::string>("string", SIZE);
+    CheckReservedPushBack<Obj>("Obj", SIZE);
+    CheckGrowth<int>("int", SIZE);
+    CheckGrowth<std::string>("string", SIZE);
+    CheckGrowth<Obj>("Obj", SIZE);
+    CheckGrowth<ThrowingMove>("ThrowingMove", SIZE);
+    CheckBulkOperations(SIZE);
+    if (timing) {
+        CheckThroughputBaselines(max_slowdown);
+    }
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        stats::Dump(std::cerr);
+        return EXIT_FAILURE;
+    }
+    std::cout << "All performance checks passed" << std::endl;
+    return EXIT_SUCCESS;
+}
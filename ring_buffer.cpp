@@ -0,0 +1,269 @@
+#pragma once
+#include "vector.cpp"
+
+#include <atomic>
+
+namespace detail {
+
+    // Размер строки кэша. Счётчики, которые изменяют разные потоки, разносятся по разным строкам,
+    // чтобы запись одного потока не вытесняла строку из кэша другого
+    inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Наименьшая степень двойки, не меньшая value
+    inline size_t RoundUpToPowerOfTwo(size_t value) noexcept {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Выполняет action(run, first, run_size) для непрерывных участков кольцевого буфера data ёмкостью
+    // mask + 1, занятых count элементами начиная с позиции position. first — номер первого элемента
+    // участка среди count элементов. Участков не больше двух
+    template <typename T, typename Action>
+    void ForEachRun(T* data, size_t mask, size_t position, size_t count, Action action) {
+        const size_t offset = position & mask;
+        const size_t first_run = std::min(count, mask + 1 - offset);
+        action(data + offset, 0, first_run);
+        if (first_run < count) {
+            action(data, first_run, count - first_run);
+        }
+    }
+
+}  // namespace detail
+
+// Ограниченная очередь для передачи элементов от одного потока-производителя одному
+// потоку-потребителю. Ёмкость округляется до степени двойки, позиции растут монотонно и
+// отображаются на ячейки маской. Обе стороны работают без ожидания: каждая операция
+// завершается за конечное число шагов независимо от другого потока
+template <typename T, typename Alloc = std::allocator<T>>
+class SpscRingBuffer {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+        "SpscRingBuffer requires non-throwing move to hand elements over");
+public:
+    explicit SpscRingBuffer(size_t capacity, const Alloc& alloc = Alloc())
+        : data_(detail::RoundUpToPowerOfTwo(std::max<size_t>(capacity, 1)), alloc)
+        , mask_(data_.Capacity() - 1) {
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    ~SpscRingBuffer() {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        detail::ForEachRun(data_.GetAddress(), mask_, head, tail - head, [](T* run, size_t, size_t count) {
+            std::destroy_n(run, count);
+        });
+    }
+
+    size_t Capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    // Количество элементов в очереди. При одновременной работе другой стороны значение приблизительное
+    size_t Size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    // Вызывается производителем. Создаёт элемент из args, если в очереди есть место
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (FreeSlots(tail, 1) == 0) {
+            return false;
+        }
+        new (data_ + (tail & mask_)) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename Type>
+    bool TryPush(Type&& value) {
+        return TryEmplace(std::forward<Type>(value));
+    }
+
+    // Вызывается производителем. Перемещает в очередь до count элементов items непрерывными участками
+    // и публикует их одной записью. Возвращает количество перемещённых элементов
+    size_t PushN(T* items, size_t count) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        count = std::min(count, FreeSlots(tail, count));
+        detail::ForEachRun(data_.GetAddress(), mask_, tail, count, [items](T* run, size_t first, size_t run_size) {
+            std::uninitialized_move_n(items + first, run_size, run);
+        });
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Вызывается потребителем. Перемещает первый элемент в out
+    bool TryPop(T& out) noexcept {
+        return PopN(&out, 1) == 1;
+    }
+
+    // Вызывается потребителем. Перемещает до count первых элементов в out и освобождает их
+    // ячейки одной записью. Возвращает количество перемещённых элементов
+    size_t PopN(T* out, size_t count) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        count = std::min(count, FilledSlots(head, count));
+        detail::ForEachRun(data_.GetAddress(), mask_, head, count, [out](T* run, size_t first, size_t run_size) {
+            std::move(run, run + run_size, out + first);
+            std::destroy_n(run, run_size);
+        });
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    // Свободные ячейки с точки зрения производителя. Позицию потребителя перечитывает,
+    // только когда по сохранённой копии свободно меньше wanted ячеек
+    size_t FreeSlots(size_t tail, size_t wanted) noexcept {
+        if (Capacity() - (tail - cached_head_) < wanted) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+        }
+        return Capacity() - (tail - cached_head_);
+    }
+
+    // Заполненные ячейки с точки зрения потребителя
+    size_t FilledSlots(size_t head, size_t wanted) noexcept {
+        if (cached_tail_ - head < wanted) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+        }
+        return cached_tail_ - head;
+    }
+
+    RawMemory<T, Alloc> data_;
+    size_t mask_;
+    // Строка потребителя: его позиция и последняя прочитанная позиция производителя
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<size_t> head_{ 0 };
+    size_t cached_tail_ = 0;
+    // Строка производителя
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<size_t> tail_{ 0 };
+    size_t cached_head_ = 0;
+};
+
+// Ограниченная очередь для любого числа производителей и потребителей. Каждая ячейка хранит
+// номер позиции, для которой она готова: производитель позиции p ждёт номера p, потребитель —
+// номера p + 1. Позиции закрепляются сравнением с обменом, поэтому очередь свободна от блокировок:
+// операция повторяется, только если другой поток успел продвинуться. Пакетные PushN и PopN
+// закрепляют сразу несколько подряд идущих позиций
+template <typename T, typename Alloc = std::allocator<T>>
+class MpmcRingBuffer {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+        "MpmcRingBuffer requires non-throwing move to hand elements over");
+    using Sequence = std::atomic<size_t>;
+    using SequenceAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Sequence>;
+public:
+    // Ёмкость не меньше двух: в очереди из одной ячейки номер «заполнена для позиции p»
+    // совпадает с номером «свободна для позиции p + 1»
+    explicit MpmcRingBuffer(size_t capacity, const Alloc& alloc = Alloc())
+        : data_(detail::RoundUpToPowerOfTwo(std::max<size_t>(capacity, 2)), alloc)
+        , sequences_(data_.Capacity(), SequenceAlloc(alloc))
+        , mask_(data_.Capacity() - 1) {
+        for (size_t i = 0; i < data_.Capacity(); ++i) {
+            new (sequences_ + i) Sequence(i);
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    ~MpmcRingBuffer() {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        detail::ForEachRun(data_.GetAddress(), mask_, head, tail - head, [](T* run, size_t, size_t count) {
+            std::destroy_n(run, count);
+        });
+    }
+
+    size_t Capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    // Количество закреплённых за производителями и ещё не закреплённых за потребителями позиций.
+    // При одновременной работе других потоков значение приблизительное
+    size_t Size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    // Создаёт элемент из args, если в очереди есть место. Элемент создаётся до закрепления позиции,
+    // поэтому исключение в конструкторе не оставляет в очереди пропусков
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        return PushN(&value, 1) == 1;
+    }
+
+    template <typename Type>
+    bool TryPush(Type&& value) {
+        return TryEmplace(std::forward<Type>(value));
+    }
+
+    // Перемещает в очередь до count элементов items. Возвращает количество перемещённых элементов
+    size_t PushN(T* items, size_t count) noexcept {
+        const auto [position, claimed] = Claim(tail_, count, 0);
+        detail::ForEachRun(data_.GetAddress(), mask_, position, claimed, [items](T* run, size_t first, size_t run_size) {
+            std::uninitialized_move_n(items + first, run_size, run);
+        });
+        Publish(position, claimed, 1);
+        return claimed;
+    }
+
+    bool TryPop(T& out) noexcept {
+        return PopN(&out, 1) == 1;
+    }
+
+    // Перемещает до count первых элементов в out. Возвращает количество перемещённых элементов
+    size_t PopN(T* out, size_t count) noexcept {
+        const auto [position, claimed] = Claim(head_, count, 1);
+        detail::ForEachRun(data_.GetAddress(), mask_, position, claimed, [out](T* run, size_t first, size_t run_size) {
+            std::move(run, run + run_size, out + first);
+            std::destroy_n(run, run_size);
+        });
+        Publish(position, claimed, Capacity());
+        return claimed;
+    }
+
+private:
+    // Закрепляет за вызывающим потоком до count подряд идущих позиций счётчика counter с номерами
+    // ячеек position + lag. Возвращает первую позицию и количество закреплённых позиций
+    std::pair<size_t, size_t> Claim(std::atomic<size_t>& counter, size_t count, size_t lag) noexcept {
+        size_t position = counter.load(std::memory_order_relaxed);
+        while (true) {
+            size_t ready = 0;
+            while (ready < count && ready <= mask_
+                && sequences_[(position + ready) & mask_].load(std::memory_order_acquire) == position + ready + lag) {
+                ++ready;
+            }
+            if (ready == 0) {
+                const size_t sequence = sequences_[position & mask_].load(std::memory_order_acquire);
+                // Ячейка ещё не готова для текущего круга: очередь пуста или заполнена
+                if (static_cast<std::ptrdiff_t>(sequence - (position + lag)) < 0) {
+                    return { position, 0 };
+                }
+                position = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+            // Пока счётчик равен position, проверенные ячейки не может закрепить другой поток
+            if (counter.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                return { position, ready };
+            }
+        }
+    }
+
+    // Передаёт ячейки позиций [position, position + count) другой стороне
+    void Publish(size_t position, size_t count, size_t advance) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            sequences_[(position + i) & mask_].store(position + i + advance, std::memory_order_release);
+        }
+    }
+
+    RawMemory<T, Alloc> data_;
+    RawMemory<Sequence, SequenceAlloc> sequences_;
+    size_t mask_;
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<size_t> head_{ 0 };
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<size_t> tail_{ 0 };
+};
@@ -0,0 +1,290 @@
+#pragma once
+#include "vector.cpp"
+#include "vector_view.cpp"
+
+#include <iterator>
+
+// Вектор, хранящий элементы в блоках по ChunkSize штук. Элементы никогда не перемещаются:
+// указатели и ссылки на них остаются действительными до удаления самих элементов, а рост
+// сводится к выделению нового блока без переноса существующих. Индекс элемента переводится
+// в номер блока и смещение в нём сдвигом и маской
+template <typename T, size_t ChunkSize = 256, typename Alloc = std::allocator<T>>
+class SegmentedVector {
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+    static constexpr size_t CHUNK_SHIFT = [] {
+        size_t shift = 0;
+        while ((size_t{ 1 } << shift) != ChunkSize) {
+            ++shift;
+        }
+        return shift;
+    }();
+    static constexpr size_t CHUNK_MASK = ChunkSize - 1;
+
+    using Chunk = RawMemory<T, Alloc>;
+
+    template <typename Value, typename Owner>
+    class BasicIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_const_t<Value>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        BasicIterator() = default;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner)
+            , index_(index) {
+        }
+
+        // Константный итератор строится из неконстантного
+        template <typename OtherValue, typename OtherOwner,
+            typename = std::enable_if_t<std::is_convertible_v<OtherValue*, Value*>>>
+        BasicIterator(const BasicIterator<OtherValue, OtherOwner>& other) noexcept
+            : owner_(other.owner_)
+            , index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+        pointer operator->() const noexcept {
+            return &(*owner_)[index_];
+        }
+        reference operator[](difference_type offset) const noexcept {
+            return (*owner_)[index_ + offset];
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+        template <typename, typename>
+        friend class BasicIterator;
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using iterator = BasicIterator<T, SegmentedVector>;
+    using const_iterator = BasicIterator<const T, const SegmentedVector>;
+    using allocator_type = Alloc;
+
+    static constexpr size_t CHUNK_SIZE = ChunkSize;
+
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(const Alloc& alloc) noexcept
+        : alloc_(alloc) {
+    }
+
+    SegmentedVector(const SegmentedVector& other)
+        : alloc_(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc_)) {
+        Reserve(other.size_);
+        for (const T& value : other) {
+            EmplaceBack(value);
+        }
+    }
+
+    SegmentedVector(SegmentedVector&& other) noexcept
+        : alloc_(other.alloc_)
+        , chunks_(std::move(other.chunks_))
+        , size_(std::exchange(other.size_, 0)) {
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& rhs) {
+        if (this != &rhs) {
+            SegmentedVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& rhs) noexcept {
+        if (this != &rhs) {
+            SegmentedVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    ~SegmentedVector() {
+        Clear();
+    }
+
+    void Swap(SegmentedVector& other) noexcept {
+        chunks_.Swap(other.chunks_);
+        std::swap(size_, other.size_);
+    }
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return chunks_.Size() * ChunkSize;
+    }
+
+    const Alloc& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<SegmentedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return chunks_[index >> CHUNK_SHIFT][index & CHUNK_MASK];
+    }
+
+    // Количество блоков, в которых есть элементы
+    size_t SegmentCount() const noexcept {
+        return (size_ + CHUNK_MASK) >> CHUNK_SHIFT;
+    }
+
+    // Элементы блока index как непрерывный массив. Позволяет обрабатывать вектор поблочно
+    VectorView<T> Segment(size_t index) noexcept {
+        assert(index < SegmentCount());
+        const size_t first = index << CHUNK_SHIFT;
+        return VectorView<T>(chunks_[index].GetAddress(), std::min(ChunkSize, size_ - first));
+    }
+
+    VectorView<const T> Segment(size_t index) const noexcept {
+        return const_cast<SegmentedVector&>(*this).Segment(index);
+    }
+
+    // Выделяет блоки, вмещающие new_capacity элементов. Существующие элементы не перемещаются
+    void Reserve(size_t new_capacity) {
+        const size_t chunk_count = (new_capacity + CHUNK_MASK) >> CHUNK_SHIFT;
+        if (chunk_count <= chunks_.Size()) {
+            return;
+        }
+        chunks_.Reserve(chunk_count);
+        while (chunks_.Size() < chunk_count) {
+            chunks_.EmplaceBack(ChunkSize, alloc_);
+        }
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    // Добавляет элемент в конец. Аргументы могут ссылаться на элементы самого вектора:
+    // при росте добавляется новый блок, а существующие элементы остаются на месте
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size_ == Capacity()) {
+            chunks_.EmplaceBack(ChunkSize, alloc_);
+        }
+        T* result = new (chunks_[size_ >> CHUNK_SHIFT] + (size_ & CHUNK_MASK)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *result;
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(&(*this)[size_ - 1]);
+            --size_;
+        }
+    }
+
+    // Удаляет все элементы, сохраняя выделенные блоки
+    void Clear() noexcept {
+        for (size_t chunk = 0; chunk < SegmentCount(); ++chunk) {
+            const size_t first = chunk << CHUNK_SHIFT;
+            std::destroy_n(chunks_[chunk].GetAddress(), std::min(ChunkSize, size_ - first));
+        }
+        size_ = 0;
+    }
+
+    // Освобождает блоки, в которых нет элементов
+    void ShrinkToFit() noexcept {
+        while (chunks_.Size() > SegmentCount()) {
+            chunks_.PopBack();
+        }
+    }
+
+private:
+    Alloc alloc_;
+    Vector<Chunk> chunks_;
+    size_t size_ = 0;
+};
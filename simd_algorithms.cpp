@@ -0,0 +1,660 @@
+#pragma once
+#include "vector.cpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ADVANCED_VECTOR_X86_DISPATCH 1
+#include <immintrin.h>
+#define ADVANCED_VECTOR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ADVANCED_VECTOR_X86_DISPATCH 0
+#endif
+
+// Линейные алгоритмы над непрерывными массивами int32_t и float, использующие векторные
+// инструкции. Набор инструкций (SSE2, AVX2 или AVX-512) выбирается при первом вызове по
+// возможностям процессора, поэтому программу не нужно собирать под конкретный процессор.
+// Для остальных типов элементов и на других архитектурах вызываются стандартные алгоритмы.
+// Загрузки невыровненные: на выровненных буферах (AlignedVector) они так же быстры, как выровненные
+namespace simd {
+
+    enum class Isa {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512,
+    };
+
+    // Наибольший набор инструкций, поддерживаемый процессором
+    inline Isa DetectIsa() noexcept {
+#if ADVANCED_VECTOR_X86_DISPATCH
+        static const Isa detected = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return Isa::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return Isa::AVX2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return Isa::SSE2;
+            }
+            return Isa::SCALAR;
+        }();
+        return detected;
+#else
+        return Isa::SCALAR;
+#endif
+    }
+
+    namespace detail {
+
+        inline std::atomic<Isa>& IsaLimit() noexcept {
+            static std::atomic<Isa> limit{ Isa::AVX512 };
+            return limit;
+        }
+
+    }  // namespace detail
+
+    // Набор инструкций, которым пользуются алгоритмы
+    inline Isa GetIsa() noexcept {
+        return std::min(DetectIsa(), detail::IsaLimit().load(std::memory_order_relaxed));
+    }
+
+    // Запрещает алгоритмам наборы инструкций старше limit. Нужно для сравнения реализаций
+    // и для процессоров, снижающих частоту при выполнении инструкций AVX-512
+    inline void LimitIsa(Isa limit) noexcept {
+        detail::IsaLimit().store(limit, std::memory_order_relaxed);
+    }
+
+    // Тип суммы элементов: целые суммируются в 64-битном типе, чтобы избежать переполнения
+    template <typename T>
+    using SumType = std::conditional_t<std::is_integral_v<T>,
+        std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, T>;
+
+    namespace detail {
+
+        template <typename T>
+        inline constexpr bool IS_SIMD_ELEMENT = std::is_same_v<T, int32_t> || std::is_same_v<T, float>;
+
+        // Реализации алгоритмов для одного набора инструкций. find возвращает индекс найденного
+        // элемента или n, min и max требуют n > 0
+        template <typename T>
+        struct Kernels {
+            size_t (*find)(const T* data, size_t n, T value);
+            size_t (*count)(const T* data, size_t n, T value);
+            T (*min)(const T* data, size_t n);
+            T (*max)(const T* data, size_t n);
+            SumType<T> (*sum)(const T* data, size_t n);
+        };
+
+        template <typename T>
+        size_t FindScalar(const T* data, size_t n, T value) {
+            return std::find(data, data + n, value) - data;
+        }
+
+        template <typename T>
+        size_t CountScalar(const T* data, size_t n, T value) {
+            return std::count(data, data + n, value);
+        }
+
+        template <typename T>
+        T MinScalar(const T* data, size_t n) {
+            return *std::min_element(data, data + n);
+        }
+
+        template <typename T>
+        T MaxScalar(const T* data, size_t n) {
+            return *std::max_element(data, data + n);
+        }
+
+        template <typename T>
+        SumType<T> SumScalar(const T* data, size_t n) {
+            return std::accumulate(data, data + n, SumType<T>{});
+        }
+
+#if ADVANCED_VECTOR_X86_DISPATCH
+
+        // SSE2
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline size_t FindSse2(const int32_t* data, size_t n, int32_t value) {
+            const __m128i needle = _mm_set1_epi32(value);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+                if (const int mask = _mm_movemask_ps(_mm_castsi128_ps(equal))) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline size_t FindSse2(const float* data, size_t n, float value) {
+            const __m128 needle = _mm_set1_ps(value);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                if (const int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle))) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline size_t CountSse2(const int32_t* data, size_t n, int32_t value) {
+            const __m128i needle = _mm_set1_epi32(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+                count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline size_t CountSse2(const float* data, size_t n, float value) {
+            const __m128 needle = _mm_set1_ps(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                count += __builtin_popcount(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle)));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        // В SSE2 нет pminsd/pmaxsd: минимум и максимум выбираются по маске сравнения
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline __m128i SelectSse2(__m128i mask, __m128i if_set, __m128i if_clear) {
+            return _mm_or_si128(_mm_and_si128(mask, if_set), _mm_andnot_si128(mask, if_clear));
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline int32_t MinSse2(const int32_t* data, size_t n) {
+            if (n < 4) {
+                return MinScalar(data, n);
+            }
+            __m128i result = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                result = SelectSse2(_mm_cmplt_epi32(x, result), x, result);
+            }
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), result);
+            int32_t tail = i < n ? MinScalar(data + i, n - i) : lanes[0];
+            return std::min({ lanes[0], lanes[1], lanes[2], lanes[3], tail });
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline int32_t MaxSse2(const int32_t* data, size_t n) {
+            if (n < 4) {
+                return MaxScalar(data, n);
+            }
+            __m128i result = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                result = SelectSse2(_mm_cmpgt_epi32(x, result), x, result);
+            }
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), result);
+            int32_t tail = i < n ? MaxScalar(data + i, n - i) : lanes[0];
+            return std::max({ lanes[0], lanes[1], lanes[2], lanes[3], tail });
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline float MinSse2(const float* data, size_t n) {
+            if (n < 4) {
+                return MinScalar(data, n);
+            }
+            __m128 result = _mm_loadu_ps(data);
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                result = _mm_min_ps(_mm_loadu_ps(data + i), result);
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, result);
+            float tail = i < n ? MinScalar(data + i, n - i) : lanes[0];
+            return std::min({ lanes[0], lanes[1], lanes[2], lanes[3], tail });
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline float MaxSse2(const float* data, size_t n) {
+            if (n < 4) {
+                return MaxScalar(data, n);
+            }
+            __m128 result = _mm_loadu_ps(data);
+            size_t i = 4;
+            for (; i + 4 <= n; i += 4) {
+                result = _mm_max_ps(_mm_loadu_ps(data + i), result);
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, result);
+            float tail = i < n ? MaxScalar(data + i, n - i) : lanes[0];
+            return std::max({ lanes[0], lanes[1], lanes[2], lanes[3], tail });
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline int64_t SumSse2(const int32_t* data, size_t n) {
+            __m128i result = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                // Расширение до 64 бит со знаком: старшие половины заполняются знаковым битом
+                const __m128i sign = _mm_srai_epi32(x, 31);
+                result = _mm_add_epi64(result, _mm_unpacklo_epi32(x, sign));
+                result = _mm_add_epi64(result, _mm_unpackhi_epi32(x, sign));
+            }
+            alignas(16) int64_t lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), result);
+            return lanes[0] + lanes[1] + SumScalar(data + i, n - i);
+        }
+
+        ADVANCED_VECTOR_TARGET("sse2")
+        inline float SumSse2(const float* data, size_t n) {
+            __m128 result = _mm_setzero_ps();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                result = _mm_add_ps(result, _mm_loadu_ps(data + i));
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, result);
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + SumScalar(data + i, n - i);
+        }
+
+        // AVX2
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline size_t FindAvx2(const int32_t* data, size_t n, int32_t value) {
+            const __m256i needle = _mm256_set1_epi32(value);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256i equal = _mm256_cmpeq_epi32(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+                if (const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal))) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline size_t FindAvx2(const float* data, size_t n, float value) {
+            const __m256 needle = _mm256_set1_ps(value);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256 equal = _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ);
+                if (const int mask = _mm256_movemask_ps(equal)) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2,popcnt")
+        inline size_t CountAvx2(const int32_t* data, size_t n, int32_t value) {
+            const __m256i needle = _mm256_set1_epi32(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256i equal = _mm256_cmpeq_epi32(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+                count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2,popcnt")
+        inline size_t CountAvx2(const float* data, size_t n, float value) {
+            const __m256 needle = _mm256_set1_ps(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                count += __builtin_popcount(_mm256_movemask_ps(
+                    _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ)));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline int32_t MinAvx2(const int32_t* data, size_t n) {
+            if (n < 8) {
+                return MinScalar(data, n);
+            }
+            __m256i result = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                result = _mm256_min_epi32(result, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            }
+            __m128i half = _mm_min_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+            half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+            half = _mm_min_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+            const int32_t lanes = _mm_cvtsi128_si32(half);
+            return i < n ? std::min(lanes, MinScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline int32_t MaxAvx2(const int32_t* data, size_t n) {
+            if (n < 8) {
+                return MaxScalar(data, n);
+            }
+            __m256i result = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                result = _mm256_max_epi32(result, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            }
+            __m128i half = _mm_max_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+            half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+            half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+            const int32_t lanes = _mm_cvtsi128_si32(half);
+            return i < n ? std::max(lanes, MaxScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline float MinAvx2(const float* data, size_t n) {
+            if (n < 8) {
+                return MinScalar(data, n);
+            }
+            __m256 result = _mm256_loadu_ps(data);
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                result = _mm256_min_ps(_mm256_loadu_ps(data + i), result);
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, result);
+            const float lanes_min = *std::min_element(lanes, lanes + 8);
+            return i < n ? std::min(lanes_min, MinScalar(data + i, n - i)) : lanes_min;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline float MaxAvx2(const float* data, size_t n) {
+            if (n < 8) {
+                return MaxScalar(data, n);
+            }
+            __m256 result = _mm256_loadu_ps(data);
+            size_t i = 8;
+            for (; i + 8 <= n; i += 8) {
+                result = _mm256_max_ps(_mm256_loadu_ps(data + i), result);
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, result);
+            const float lanes_max = *std::max_element(lanes, lanes + 8);
+            return i < n ? std::max(lanes_max, MaxScalar(data + i, n - i)) : lanes_max;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline int64_t SumAvx2(const int32_t* data, size_t n) {
+            __m256i result = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                result = _mm256_add_epi64(result, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+                result = _mm256_add_epi64(result, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+            }
+            alignas(32) int64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), result);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + SumScalar(data + i, n - i);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx2")
+        inline float SumAvx2(const float* data, size_t n) {
+            __m256 result = _mm256_setzero_ps();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                result = _mm256_add_ps(result, _mm256_loadu_ps(data + i));
+            }
+            const __m128 half = _mm_add_ps(_mm256_castps256_ps128(result), _mm256_extractf128_ps(result, 1));
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, half);
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + SumScalar(data + i, n - i);
+        }
+
+        // AVX-512
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline size_t FindAvx512(const int32_t* data, size_t n, int32_t value) {
+            const __m512i needle = _mm512_set1_epi32(value);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                if (const __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle)) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline size_t FindAvx512(const float* data, size_t n, float value) {
+            const __m512 needle = _mm512_set1_ps(value);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                if (const __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), needle, _CMP_EQ_OQ)) {
+                    return i + __builtin_ctz(mask);
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f,popcnt")
+        inline size_t CountAvx512(const int32_t* data, size_t n, int32_t value) {
+            const __m512i needle = _mm512_set1_epi32(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                count += __builtin_popcount(_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f,popcnt")
+        inline size_t CountAvx512(const float* data, size_t n, float value) {
+            const __m512 needle = _mm512_set1_ps(value);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                count += __builtin_popcount(_mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), needle, _CMP_EQ_OQ));
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline int32_t MinAvx512(const int32_t* data, size_t n) {
+            if (n < 16) {
+                return MinScalar(data, n);
+            }
+            __m512i result = _mm512_loadu_si512(data);
+            size_t i = 16;
+            for (; i + 16 <= n; i += 16) {
+                result = _mm512_min_epi32(result, _mm512_loadu_si512(data + i));
+            }
+            const int32_t lanes = _mm512_reduce_min_epi32(result);
+            return i < n ? std::min(lanes, MinScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline int32_t MaxAvx512(const int32_t* data, size_t n) {
+            if (n < 16) {
+                return MaxScalar(data, n);
+            }
+            __m512i result = _mm512_loadu_si512(data);
+            size_t i = 16;
+            for (; i + 16 <= n; i += 16) {
+                result = _mm512_max_epi32(result, _mm512_loadu_si512(data + i));
+            }
+            const int32_t lanes = _mm512_reduce_max_epi32(result);
+            return i < n ? std::max(lanes, MaxScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline float MinAvx512(const float* data, size_t n) {
+            if (n < 16) {
+                return MinScalar(data, n);
+            }
+            __m512 result = _mm512_loadu_ps(data);
+            size_t i = 16;
+            for (; i + 16 <= n; i += 16) {
+                result = _mm512_min_ps(_mm512_loadu_ps(data + i), result);
+            }
+            const float lanes = _mm512_reduce_min_ps(result);
+            return i < n ? std::min(lanes, MinScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline float MaxAvx512(const float* data, size_t n) {
+            if (n < 16) {
+                return MaxScalar(data, n);
+            }
+            __m512 result = _mm512_loadu_ps(data);
+            size_t i = 16;
+            for (; i + 16 <= n; i += 16) {
+                result = _mm512_max_ps(_mm512_loadu_ps(data + i), result);
+            }
+            const float lanes = _mm512_reduce_max_ps(result);
+            return i < n ? std::max(lanes, MaxScalar(data + i, n - i)) : lanes;
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline int64_t SumAvx512(const int32_t* data, size_t n) {
+            __m512i result = _mm512_setzero_si512();
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                const __m512i x = _mm512_loadu_si512(data + i);
+                result = _mm512_add_epi64(result, _mm512_cvtepi32_epi64(_mm512_castsi512_si256(x)));
+                result = _mm512_add_epi64(result, _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(x, 1)));
+            }
+            return _mm512_reduce_add_epi64(result) + SumScalar(data + i, n - i);
+        }
+
+        ADVANCED_VECTOR_TARGET("avx512f")
+        inline float SumAvx512(const float* data, size_t n) {
+            __m512 result = _mm512_setzero_ps();
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16) {
+                result = _mm512_add_ps(result, _mm512_loadu_ps(data + i));
+            }
+            return _mm512_reduce_add_ps(result) + SumScalar(data + i, n - i);
+        }
+
+#endif  // ADVANCED_VECTOR_X86_DISPATCH
+
+        // Реализации для набора инструкций isa
+        template <typename T>
+        const Kernels<T>& GetKernels(Isa isa) noexcept {
+            static_assert(IS_SIMD_ELEMENT<T>);
+#if ADVANCED_VECTOR_X86_DISPATCH
+            static const Kernels<T> kernels[] = {
+                { FindScalar<T>, CountScalar<T>, MinScalar<T>, MaxScalar<T>, SumScalar<T> },
+                { FindSse2, CountSse2, MinSse2, MaxSse2, SumSse2 },
+                { FindAvx2, CountAvx2, MinAvx2, MaxAvx2, SumAvx2 },
+                { FindAvx512, CountAvx512, MinAvx512, MaxAvx512, SumAvx512 },
+            };
+            return kernels[static_cast<size_t>(isa)];
+#else
+            static const Kernels<T> kernels = { FindScalar<T>, CountScalar<T>, MinScalar<T>, MaxScalar<T>, SumScalar<T> };
+            (void)isa;
+            return kernels;
+#endif
+        }
+
+    }  // namespace detail
+
+    template <typename T>
+    const T* Find(const T* first, const T* last, const T& value) {
+        if constexpr (detail::IS_SIMD_ELEMENT<T>) {
+            return first + detail::GetKernels<T>(GetIsa()).find(first, last - first, value);
+        }
+        else {
+            return std::find(first, last, value);
+        }
+    }
+
+    template <typename T>
+    size_t Count(const T* first, const T* last, const T& value) {
+        if constexpr (detail::IS_SIMD_ELEMENT<T>) {
+            return detail::GetKernels<T>(GetIsa()).count(first, last - first, value);
+        }
+        else {
+            return std::count(first, last, value);
+        }
+    }
+
+    // Наименьший элемент непустого диапазона. Если среди значений float есть NaN, результат не определён
+    template <typename T>
+    T Min(const T* first, const T* last) {
+        assert(first != last);
+        if constexpr (detail::IS_SIMD_ELEMENT<T>) {
+            return detail::GetKernels<T>(GetIsa()).min(first, last - first);
+        }
+        else {
+            return *std::min_element(first, last);
+        }
+    }
+
+    // Наибольший элемент непустого диапазона. Если среди значений float есть NaN, результат не определён
+    template <typename T>
+    T Max(const T* first, const T* last) {
+        assert(first != last);
+        if constexpr (detail::IS_SIMD_ELEMENT<T>) {
+            return detail::GetKernels<T>(GetIsa()).max(first, last - first);
+        }
+        else {
+            return *std::max_element(first, last);
+        }
+    }
+
+    // Сумма элементов. Значения float складываются в нескольких частичных суммах, поэтому
+    // результат может отличаться от последовательного сложения в пределах погрешности округления
+    template <typename T>
+    SumType<T> Sum(const T* first, const T* last) {
+        if constexpr (detail::IS_SIMD_ELEMENT<T>) {
+            return detail::GetKernels<T>(GetIsa()).sum(first, last - first);
+        }
+        else {
+            return std::accumulate(first, last, SumType<T>{});
+        }
+    }
+
+    // Заполнение не требует ручной векторизации: цикл без раннего выхода компилятор
+    // векторизует сам, а для байтовых типов вызывает memset
+    template <typename T>
+    void Fill(T* first, T* last, const T& value) {
+        std::fill(first, last, value);
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    typename Vector<T, Alloc, Growth>::const_iterator Find(const Vector<T, Alloc, Growth>& v, const T& value) {
+        return Find(v.begin(), v.end(), value);
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    size_t Count(const Vector<T, Alloc, Growth>& v, const T& value) {
+        return Count(v.begin(), v.end(), value);
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    T Min(const Vector<T, Alloc, Growth>& v) {
+        return Min(v.begin(), v.end());
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    T Max(const Vector<T, Alloc, Growth>& v) {
+        return Max(v.begin(), v.end());
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    SumType<T> Sum(const Vector<T, Alloc, Growth>& v) {
+        return Sum(v.begin(), v.end());
+    }
+
+    template <typename T, typename Alloc, typename Growth>
+    void Fill(Vector<T, Alloc, Growth>& v, const T& value) {
+        Fill(v.begin(), v.end(), value);
+    }
+
+}  // namespace simd
@@ -0,0 +1,232 @@
+#pragma once
+#include "vector.cpp"
+
+// Вектор, хранящий до N элементов во встроенном буфере и переходящий на динамическую память
+// при превышении этого размера. Интерфейс и гарантии безопасности исключений совпадают с Vector
+template <typename T, size_t N, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+class SmallVector {
+    static_assert(N > 0, "use Vector for containers without inline storage");
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = Alloc;
+
+    SmallVector() = default;
+
+    explicit SmallVector(const Alloc& alloc) noexcept
+        : heap_(alloc) {
+    }
+
+    explicit SmallVector(size_t size, const Alloc& alloc = Alloc())
+        : heap_(alloc) {
+        Reserve(size);
+        std::uninitialized_value_construct_n(begin(), size);
+        size_ = size;
+    }
+
+    SmallVector(const SmallVector& other)
+        : heap_(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.GetAllocator())) {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.begin(), other.size_, begin());
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : heap_(other.GetAllocator()) {
+        if (other.IsInline()) {
+            std::uninitialized_move_n(other.begin(), other.size_, begin());
+            std::destroy_n(other.begin(), other.size_);
+        }
+        else {
+            heap_.Swap(other.heap_);
+        }
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    SmallVector& operator=(const SmallVector& rhs) {
+        if (this != &rhs) {
+            if (rhs.size_ > Capacity()) {
+                /* Применить copy-and-swap */
+                SmallVector rhs_copy(rhs);
+                Swap(rhs_copy);
+            }
+            else {
+                /* Скопировать элементы из rhs, создав при необходимости новые
+                   или удалив существующие */
+                auto count = std::min(rhs.size_, size_);
+                std::copy(rhs.begin(), rhs.begin() + count, begin());
+                if (rhs.size_ < size_) {
+                    std::destroy_n(begin() + rhs.size_, size_ - rhs.size_);
+                }
+                else {
+                    std::uninitialized_copy_n(rhs.begin() + size_, rhs.size_ - size_, begin() + size_);
+                }
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>
+        && std::is_nothrow_swappable_v<T>) {
+        if (this != &rhs) {
+            SmallVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    void Swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>) {
+        if (!IsInline() && !other.IsInline()) {
+            heap_.Swap(other.heap_);
+        }
+        else if (IsInline() && other.IsInline()) {
+            SmallVector& larger = size_ < other.size_ ? other : *this;
+            SmallVector& smaller = size_ < other.size_ ? *this : other;
+            std::swap_ranges(smaller.begin(), smaller.end(), larger.begin());
+            detail::UninitializedRelocateN(larger.begin() + smaller.size_, larger.size_ - smaller.size_,
+                smaller.begin() + smaller.size_);
+        }
+        else {
+            /* Встроенный буфер вектора, живущего в динамической памяти, свободен —
+               элементы второго вектора переезжают в него */
+            SmallVector& on_heap = IsInline() ? other : *this;
+            SmallVector& in_place = IsInline() ? *this : other;
+            detail::UninitializedRelocateN(in_place.begin(), in_place.size_, on_heap.InlineData());
+            heap_.Swap(other.heap_);
+        }
+        std::swap(size_, other.size_);
+    }
+
+    ~SmallVector() {
+        std::destroy_n(begin(), size_);
+    }
+
+    iterator begin() noexcept {
+        return IsInline() ? InlineData() : heap_.GetAddress();
+    }
+    iterator end() noexcept {
+        return begin() + size_;
+    }
+    const_iterator begin() const noexcept {
+        return const_cast<SmallVector&>(*this).begin();
+    }
+    const_iterator end() const noexcept {
+        return begin() + size_;
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        assert(pos >= begin() && pos <= end());
+        iterator result = nullptr;
+        size_t count = pos - begin();
+        if (size_ == Capacity()) {
+            RawMemory<T, Alloc> new_data(NextCapacity(), GetAllocator());
+            result = detail::RelocateAndEmplace(begin(), size_, count, new_data.GetAddress(), std::forward<Args>(args)...);
+            heap_.Swap(new_data);
+        }
+        else {
+            result = detail::EmplaceShift(begin(), size_, count, std::forward<Args>(args)...);
+        }
+        ++size_;
+        return result;
+    }
+
+    iterator Erase(const_iterator pos) noexcept {
+        assert(pos >= begin() && pos < end());
+        size_t count = pos - begin();
+        detail::EraseShift(begin(), size_, count);
+        --size_;
+        return begin() + count;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, GetAllocator());
+        detail::UninitializedRelocateN(begin(), size_, new_data.GetAddress());
+        heap_.Swap(new_data);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size > size_) {
+            Reserve(new_size);
+            std::uninitialized_value_construct_n(begin() + size_, new_size - size_);
+        }
+        else {
+            std::destroy_n(begin() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        return *Emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(begin() + size_ - 1);
+            --size_;
+        }
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return IsInline() ? N : heap_.Capacity();
+    }
+
+    // Элементы хранятся во встроенном буфере
+    bool IsInline() const noexcept {
+        return heap_.GetAddress() == nullptr;
+    }
+
+    const Alloc& GetAllocator() const noexcept {
+        return heap_.GetAllocator();
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<SmallVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return begin()[index];
+    }
+
+private:
+    size_t NextCapacity() const noexcept {
+        return Growth::NextCapacity(Capacity(), size_ + 1, sizeof(T));
+    }
+
+    T* InlineData() noexcept {
+        return reinterpret_cast<T*>(inline_);
+    }
+
+    // Пуст, пока элементы помещаются во встроенный буфер
+    RawMemory<T, Alloc> heap_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+    size_t size_ = 0;
+};
@@ -0,0 +1,312 @@
+#pragma once
+#include "vector.cpp"
+#include "vector_view.cpp"
+
+#include <tuple>
+
+// Вектор записей из полей Fields..., хранящий каждое поле в отдельном непрерывном массиве
+// (structure of arrays). Проход по одному-двум полям не тянет через кэш остальные.
+// Все столбцы имеют общие размер и ёмкость и растут по политике Growth так же, как Vector
+template <typename Growth, typename... Fields>
+class BasicSoAVector {
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+    template <size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using Columns = std::tuple<RawMemory<Fields>...>;
+
+    static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+    // Суммарный размер записи, по которому политика роста выбирает ёмкость
+    static constexpr size_t RECORD_SIZE = (sizeof(Fields) + ...);
+
+    // Перенос элементов поля не бросает исключений
+    template <typename F>
+    static constexpr bool IS_NOTHROW_TRANSFER = IsTriviallyRelocatable<F>::value
+        || std::is_nothrow_move_constructible_v<F>;
+
+public:
+    // Ссылка на запись: кортеж ссылок на её поля, поддерживает структурные привязки
+    using Reference = std::tuple<Fields&...>;
+    using ConstReference = std::tuple<const Fields&...>;
+
+    BasicSoAVector() = default;
+
+    explicit BasicSoAVector(size_t size) {
+        Resize(size);
+    }
+
+    BasicSoAVector(const BasicSoAVector& other) {
+        Columns new_columns = AllocateColumns(other.size_);
+        size_t copied = 0;
+        try {
+            ForEachField([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                detail::UninitializedCopyN(other.template Data<I>(), other.size_, std::get<I>(new_columns).GetAddress());
+                ++copied;
+            });
+        }
+        catch (...) {
+            DestroyFields(new_columns, 0, other.size_, copied);
+            throw;
+        }
+        SwapColumns(columns_, new_columns);
+        size_ = other.size_;
+    }
+
+    BasicSoAVector(BasicSoAVector&& other) noexcept {
+        Swap(other);
+    }
+
+    BasicSoAVector& operator=(const BasicSoAVector& rhs) {
+        if (this != &rhs) {
+            BasicSoAVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    BasicSoAVector& operator=(BasicSoAVector&& rhs) noexcept {
+        if (this != &rhs) {
+            BasicSoAVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    ~BasicSoAVector() {
+        DestroyFields(columns_, 0, size_, FIELD_COUNT);
+    }
+
+    void Swap(BasicSoAVector& other) noexcept {
+        SwapColumns(columns_, other.columns_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return std::get<0>(columns_).Capacity();
+    }
+
+    // Столбец поля I: непрерывный массив значений этого поля у всех записей
+    template <size_t I>
+    VectorView<Field<I>> Column() noexcept {
+        return VectorView<Field<I>>(Data<I>(), size_);
+    }
+
+    template <size_t I>
+    VectorView<const Field<I>> Column() const noexcept {
+        return VectorView<const Field<I>>(Data<I>(), size_);
+    }
+
+    template <size_t I>
+    Field<I>& Get(size_t index) noexcept {
+        assert(index < size_);
+        return Data<I>()[index];
+    }
+
+    template <size_t I>
+    const Field<I>& Get(size_t index) const noexcept {
+        return const_cast<BasicSoAVector&>(*this).template Get<I>(index);
+    }
+
+    Reference operator[](size_t index) noexcept {
+        assert(index < size_);
+        return MakeReference<Reference>(*this, index, std::index_sequence_for<Fields...>{});
+    }
+
+    ConstReference operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return MakeReference<ConstReference>(*this, index, std::index_sequence_for<Fields...>{});
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        Columns new_columns = AllocateColumns(new_capacity);
+        RelocateTo(new_columns);
+        SwapColumns(columns_, new_columns);
+    }
+
+    // Добавляет запись, поле I которой создаётся из аргумента args[I]. Аргументы могут ссылаться
+    // на записи самого вектора. При исключении вектор не изменяется
+    template <typename... Args>
+    Reference EmplaceBack(Args&&... args) {
+        static_assert(sizeof...(Args) == FIELD_COUNT, "EmplaceBack takes one argument per field");
+        if (size_ == Capacity()) {
+            Columns new_columns = AllocateColumns(Growth::NextCapacity(Capacity(), size_ + 1, RECORD_SIZE));
+            ConstructRecord(new_columns, size_, std::forward<Args>(args)...);
+            try {
+                RelocateTo(new_columns);
+            }
+            catch (...) {
+                DestroyFields(new_columns, size_, 1, FIELD_COUNT);
+                throw;
+            }
+            SwapColumns(columns_, new_columns);
+        }
+        else {
+            ConstructRecord(columns_, size_, std::forward<Args>(args)...);
+        }
+        ++size_;
+        return (*this)[size_ - 1];
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            DestroyFields(columns_, size_ - 1, 1, FIELD_COUNT);
+            --size_;
+        }
+    }
+
+    void Erase(size_t index) noexcept {
+        Erase(index, index + 1);
+    }
+
+    // Удаляет записи [first, last), сдвигая хвост каждого столбца один раз
+    void Erase(size_t first, size_t last) noexcept {
+        assert(first <= last && last <= size_);
+        if (first == last) {
+            return;
+        }
+        ForEachField([&](auto index) {
+            detail::EraseShift(Data<decltype(index)::value>(), size_, first, last - first);
+        });
+        size_ -= last - first;
+    }
+
+    // Новые записи инициализируются значениями по умолчанию. При исключении вектор не изменяется
+    void Resize(size_t new_size) {
+        if (new_size > size_) {
+            Reserve(new_size);
+            const size_t count = new_size - size_;
+            size_t constructed = 0;
+            try {
+                ForEachField([&](auto index) {
+                    std::uninitialized_value_construct_n(Data<decltype(index)::value>() + size_, count);
+                    ++constructed;
+                });
+            }
+            catch (...) {
+                DestroyFields(columns_, size_, count, constructed);
+                throw;
+            }
+        }
+        else {
+            DestroyFields(columns_, new_size, size_ - new_size, FIELD_COUNT);
+        }
+        size_ = new_size;
+    }
+
+    // Удаляет все записи, сохраняя ёмкость
+    void Clear() noexcept {
+        DestroyFields(columns_, 0, size_, FIELD_COUNT);
+        size_ = 0;
+    }
+
+private:
+    template <typename Action>
+    static void ForEachField(Action&& action) {
+        ForEachField(action, std::index_sequence_for<Fields...>{});
+    }
+
+    template <typename Action, size_t... I>
+    static void ForEachField(Action& action, std::index_sequence<I...>) {
+        (action(std::integral_constant<size_t, I>{}), ...);
+    }
+
+    template <size_t I>
+    Field<I>* Data() noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template <size_t I>
+    const Field<I>* Data() const noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template <typename Ref, typename Self, size_t... I>
+    static Ref MakeReference(Self& self, size_t index, std::index_sequence<I...>) noexcept {
+        return Ref(self.template Data<I>()[index]...);
+    }
+
+    static void SwapColumns(Columns& lhs, Columns& rhs) noexcept {
+        ForEachField([&](auto index) {
+            std::get<decltype(index)::value>(lhs).Swap(std::get<decltype(index)::value>(rhs));
+        });
+    }
+
+    static Columns AllocateColumns(size_t capacity) {
+        return Columns(RawMemory<Fields>(capacity)...);
+    }
+
+    // Разрушает записи [first, first + count) в первых field_count столбцах
+    static void DestroyFields(Columns& columns, size_t first, size_t count, size_t field_count) noexcept {
+        ForEachField([&](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            if (I < field_count) {
+                std::destroy_n(std::get<I>(columns).GetAddress() + first, count);
+            }
+        });
+    }
+
+    template <typename... Args>
+    static void ConstructRecord(Columns& columns, size_t pos, Args&&... args) {
+        auto values = std::forward_as_tuple(std::forward<Args>(args)...);
+        size_t constructed = 0;
+        try {
+            ForEachField([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                new (std::get<I>(columns) + pos) Field<I>(std::get<I>(std::move(values)));
+                ++constructed;
+            });
+        }
+        catch (...) {
+            DestroyFields(columns, pos, 1, constructed);
+            throw;
+        }
+    }
+
+    // Переносит записи в неинициализированные столбцы to. Сначала копируются поля, перенос которых
+    // может бросить исключение, и только затем переносятся остальные: при исключении вектор не изменяется
+    void RelocateTo(Columns& to) {
+        bool copied[FIELD_COUNT] = {};
+        try {
+            ForEachField([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                if constexpr (!IS_NOTHROW_TRANSFER<Field<I>>) {
+                    detail::UninitializedMoveOrCopyN(Data<I>(), size_, std::get<I>(to).GetAddress());
+                    copied[I] = true;
+                }
+            });
+        }
+        catch (...) {
+            ForEachField([&](auto index) {
+                constexpr size_t I = decltype(index)::value;
+                if (copied[I]) {
+                    std::destroy_n(std::get<I>(to).GetAddress(), size_);
+                }
+            });
+            throw;
+        }
+        ForEachField([&](auto index) {
+            constexpr size_t I = decltype(index)::value;
+            if constexpr (IS_NOTHROW_TRANSFER<Field<I>>) {
+                detail::UninitializedRelocateN(Data<I>(), size_, std::get<I>(to).GetAddress());
+            }
+            else {
+                std::destroy_n(Data<I>(), size_);
+            }
+        });
+    }
+
+    Columns columns_;
+    size_t size_ = 0;
+};
+
+template <typename... Fields>
+using SoAVector = BasicSoAVector<DoublingGrowth, Fields...>;
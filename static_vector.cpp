@@ -0,0 +1,220 @@
+#pragma once
+#include "vector.cpp"
+
+#include <stdexcept>
+
+// Вектор фиксированной ёмкости N с элементами во встроенном буфере. Никогда не обращается
+// к динамической памяти и не растёт: вставка в заполненный вектор бросает std::length_error,
+// а TryEmplaceBack возвращает nullptr. Вставка и удаление выполняются теми же сдвигами, что и в Vector
+template <typename T, size_t N>
+class StaticVector {
+    static_assert(N > 0, "StaticVector needs a non-zero capacity");
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    StaticVector() = default;
+
+    explicit StaticVector(size_t size) {
+        CheckCapacity(size);
+        std::uninitialized_value_construct_n(begin(), size);
+        size_ = size;
+    }
+
+    StaticVector(std::initializer_list<T> init) {
+        CheckCapacity(init.size());
+        detail::UninitializedCopyN(init.begin(), init.size(), begin());
+        size_ = init.size();
+    }
+
+    StaticVector(const StaticVector& other) {
+        detail::UninitializedCopyN(other.begin(), other.size_, begin());
+        size_ = other.size_;
+    }
+
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move_n(other.begin(), other.size_, begin());
+        size_ = other.size_;
+        other.Clear();
+    }
+
+    StaticVector& operator=(const StaticVector& rhs) {
+        if (this != &rhs) {
+            Assign(rhs.begin(), rhs.size_, [](const T* from, size_t count, T* to) {
+                std::copy_n(from, count, to);
+            }, [](const T* from, size_t count, T* to) {
+                detail::UninitializedCopyN(from, count, to);
+            });
+        }
+        return *this;
+    }
+
+    StaticVector& operator=(StaticVector&& rhs) noexcept(std::is_nothrow_move_assignable_v<T>
+        && std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            Assign(rhs.begin(), rhs.size_, [](T* from, size_t count, T* to) {
+                std::move(from, from + count, to);
+            }, [](T* from, size_t count, T* to) {
+                std::uninitialized_move_n(from, count, to);
+            });
+            rhs.Clear();
+        }
+        return *this;
+    }
+
+    ~StaticVector() {
+        std::destroy_n(begin(), size_);
+    }
+
+    void Swap(StaticVector& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>) {
+        StaticVector& larger = size_ < other.size_ ? other : *this;
+        StaticVector& smaller = size_ < other.size_ ? *this : other;
+        std::swap_ranges(smaller.begin(), smaller.end(), larger.begin());
+        detail::UninitializedRelocateN(larger.begin() + smaller.size_, larger.size_ - smaller.size_,
+            smaller.begin() + smaller.size_);
+        std::swap(size_, other.size_);
+    }
+
+    iterator begin() noexcept {
+        return reinterpret_cast<T*>(storage_);
+    }
+    iterator end() noexcept {
+        return begin() + size_;
+    }
+    const_iterator begin() const noexcept {
+        return reinterpret_cast<const T*>(storage_);
+    }
+    const_iterator end() const noexcept {
+        return begin() + size_;
+    }
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args) {
+        assert(pos >= begin() && pos <= end());
+        CheckCapacity(size_ + 1);
+        iterator result = detail::EmplaceShift(begin(), size_, pos - begin(), std::forward<Args>(args)...);
+        ++size_;
+        return result;
+    }
+
+    iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+    iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    iterator Erase(const_iterator pos) noexcept {
+        assert(pos >= begin() && pos < end());
+        size_t count = pos - begin();
+        detail::EraseShift(begin(), size_, count);
+        --size_;
+        return begin() + count;
+    }
+
+    iterator Erase(const_iterator first, const_iterator last) noexcept {
+        assert(first >= begin() && first <= last && last <= end());
+        size_t count = first - begin();
+        if (first != last) {
+            const size_t erased = last - first;
+            detail::EraseShift(begin(), size_, count, erased);
+            size_ -= erased;
+        }
+        return begin() + count;
+    }
+
+    template <typename Type>
+    void PushBack(Type&& value) {
+        EmplaceBack(std::forward<Type>(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        CheckCapacity(size_ + 1);
+        return *NoCheckEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    // Аналог EmplaceBack, возвращающий nullptr, если вектор заполнен
+    template <typename... Args>
+    T* TryEmplaceBack(Args&&... args) {
+        return size_ < N ? NoCheckEmplaceBack(std::forward<Args>(args)...) : nullptr;
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(begin() + size_ - 1);
+            --size_;
+        }
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size > size_) {
+            CheckCapacity(new_size);
+            std::uninitialized_value_construct_n(end(), new_size - size_);
+        }
+        else {
+            std::destroy_n(begin() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
+
+    void Clear() noexcept {
+        std::destroy_n(begin(), size_);
+        size_ = 0;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return const_cast<StaticVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return begin()[index];
+    }
+
+private:
+    static void CheckCapacity(size_t size) {
+        if (size > N) {
+            detail::Throw(std::length_error("StaticVector capacity exceeded"));
+        }
+    }
+
+    template <typename... Args>
+    T* NoCheckEmplaceBack(Args&&... args) {
+        T* result = new (end()) T(std::forward<Args>(args)...);
+        ++size_;
+        return result;
+    }
+
+    // Присваивает count элементов from: общая часть присваивается assign, недостающие элементы
+    // создаются construct, лишние разрушаются
+    template <typename From, typename AssignN, typename ConstructN>
+    void Assign(From* from, size_t count, AssignN assign, ConstructN construct) {
+        const size_t common = std::min(count, size_);
+        assign(from, common, begin());
+        if (count < size_) {
+            std::destroy_n(begin() + count, size_ - count);
+        }
+        else {
+            construct(from + common, count - common, end());
+        }
+        size_ = count;
+    }
+
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+    size_t size_ = 0;
+};
@@ -1,25 +1,374 @@
 #pragma once
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <new>
 #include <utility>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <limits>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+
+#include "vector_exceptions.cpp"
+#include "vector_parallel.cpp"
+#include "vector_reclaimer.cpp"
+#include "vector_stats.cpp"
+
+// Объект типа T можно перенести в другой участок памяти побайтовым копированием,
+// после чего исходную память достаточно освободить, не вызывая деструктор.
+// Для собственных типов с таким свойством допускается специализация
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {
+};
+
+template <typename T, typename Deleter>
+struct IsTriviallyRelocatable<std::unique_ptr<T, Deleter>> : IsTriviallyRelocatable<Deleter> {
+};
 
 template <typename T>
+struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type {
+};
+
+namespace detail {
+
+    // Разрушает count элементов, начиная с first. Для типов с тривиальным деструктором не делает
+    // ничего и не зависит от того, уберёт ли пустой цикл оптимизатор
+    template <typename T>
+    void DestroyN(T* first, size_t count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_n(first, count);
+        }
+    }
+
+    template <typename T>
+    void DestroyAt(T* p) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_at(p);
+        }
+    }
+
+    // Перемещает count элементов в неинициализированную память, если перемещение не бросает исключений
+    // или копирование невозможно, иначе копирует их. Исходные элементы остаются живыми
+    template <typename T>
+    void UninitializedMoveOrCopyN(T* from, size_t count, T* to) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(from, count, to);
+            stats::OnMove<T>(count);
+        }
+        else {
+            std::uninitialized_copy_n(from, count, to);
+            stats::OnCopy<T>(count);
+        }
+    }
+
+    // Переносит count элементов в неинициализированную память. Исходные элементы перестают существовать,
+    // а при исключении остаются нетронутыми
+    template <typename T>
+    void UninitializedRelocateN(T* from, size_t count, T* to) {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+            }
+            stats::OnRelocateBitwise<T>(count);
+        }
+        else {
+            UninitializedMoveOrCopyN(from, count, to);
+            detail::DestroyN(from, count);
+        }
+    }
+
+    // Сдвигает побайтово count элементов в пересекающийся участок памяти
+    template <typename T>
+    void RelocateOverlappingN(T* from, size_t count, T* to) noexcept {
+        static_assert(IsTriviallyRelocatable<T>::value);
+        if (count != 0) {
+            std::memmove(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+        }
+    }
+
+    // Итератор It указывает на непрерывный массив элементов T, который можно скопировать memcpy
+    template <typename T, typename It>
+    inline constexpr bool IS_MEMCPY_SOURCE = std::is_trivially_copyable_v<T> && std::is_pointer_v<It>
+        && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>;
+
+    // Копирует count элементов, начиная с first, в неинициализированную память
+    template <typename T, typename ForwardIt>
+    void UninitializedCopyN(ForwardIt first, size_t count, T* to) {
+        if constexpr (IS_MEMCPY_SOURCE<T, ForwardIt>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void*>(to), static_cast<const void*>(first), count * sizeof(T));
+            }
+        }
+        else {
+            std::uninitialized_copy_n(first, count, to);
+        }
+    }
+
+    // Переносит size элементов из from в неинициализированный буфер to, оставляя в позиции pos
+    // пропуск из gap элементов. При исключении from остаётся нетронутым, а в to не остаётся объектов
+    template <typename T>
+    void RelocateAround(T* from, size_t size, size_t pos, size_t gap, T* to) {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            UninitializedRelocateN(from, pos, to);
+            UninitializedRelocateN(from + pos, size - pos, to + pos + gap);
+        }
+        else {
+            UninitializedMoveOrCopyN(from, pos, to);
+            ADVANCED_VECTOR_TRY {
+                UninitializedMoveOrCopyN(from + pos, size - pos, to + pos + gap);
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                detail::DestroyN(to, pos);
+                ADVANCED_VECTOR_RETHROW;
+            }
+            detail::DestroyN(from, size);
+        }
+    }
+
+    // Создаёт элемент в позиции pos неинициализированного буфера to и переносит вокруг него
+    // size элементов из from. При исключении from остаётся нетронутым, а to — пустым
+    template <typename T, typename... Args>
+    T* RelocateAndEmplace(T* from, size_t size, size_t pos, T* to, Args&&... args) {
+        T* result = new (to + pos) T(std::forward<Args>(args)...);
+        ADVANCED_VECTOR_TRY {
+            RelocateAround(from, size, pos, 1, to);
+        }
+        ADVANCED_VECTOR_CATCH_ALL {
+            detail::DestroyAt(result);
+            ADVANCED_VECTOR_RETHROW;
+        }
+        return result;
+    }
+
+    // Вставляет элемент в позицию pos массива data из size элементов, за которым есть место
+    // ещё под один элемент
+    template <typename T, typename... Args>
+    T* EmplaceShift(T* data, size_t size, size_t pos, Args&&... args) {
+        if (pos == size) {
+            return new (data + size) T(std::forward<Args>(args)...);
+        }
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            // Элемент создаётся до сдвига, так как args могут ссылаться на элементы самого массива
+            alignas(T) unsigned char slot[sizeof(T)];
+            T* value = new (slot) T(std::forward<Args>(args)...);
+            RelocateOverlappingN(data + pos, size - pos, data + pos + 1);
+            UninitializedRelocateN(value, 1, data + pos);
+        }
+        else {
+            new (data + size) T(std::move(data[size - 1]));
+            ADVANCED_VECTOR_TRY {
+                std::move_backward(data + pos, data + size - 1, data + size);
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                detail::DestroyAt(data + size);
+                ADVANCED_VECTOR_RETHROW;
+            }
+            detail::DestroyAt(data + pos);
+            new (data + pos) T(std::forward<Args>(args)...);
+        }
+        return data + pos;
+    }
+
+    // Удаляет count элементов, начиная с позиции pos, массива data из size элементов,
+    // сдвигая хвост к началу
+    template <typename T>
+    void EraseShift(T* data, size_t size, size_t pos, size_t count = 1) noexcept {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            detail::DestroyN(data + pos, count);
+            RelocateOverlappingN(data + pos + count, size - pos - count, data + pos);
+        }
+        else {
+            std::move(data + pos + count, data + size, data + pos);
+            detail::DestroyN(data + size - count, count);
+        }
+    }
+
+    // Аллокатор умеет переносить блок в памяти: T* reallocate(T* p, size_t old_n, size_t new_n)
+    template <typename Alloc, typename = void>
+    struct HasReallocate : std::false_type {
+    };
+
+    template <typename Alloc>
+    struct HasReallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+        std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {
+    };
+
+    // Аллокатор умеет расширять блок без переноса: bool try_expand(T* p, size_t old_n, size_t new_n)
+    template <typename Alloc, typename = void>
+    struct HasTryExpand : std::false_type {
+    };
+
+    template <typename Alloc>
+    struct HasTryExpand<Alloc, std::void_t<decltype(std::declval<Alloc&>().try_expand(
+        std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {
+    };
+
+    // Аллокатор умеет выделять память без исключений: T* try_allocate(size_t n) noexcept
+    // возвращает nullptr, если памяти не хватило
+    template <typename Alloc, typename = void>
+    struct HasTryAllocate : std::false_type {
+    };
+
+    template <typename Alloc>
+    struct HasTryAllocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().try_allocate(size_t{}))>>
+        : std::true_type {
+    };
+
+}  // namespace detail
+
+// Аллокатор поверх malloc/free. Поддерживает reallocate, поэтому вектор тривиально переносимых
+// элементов растёт через realloc: на месте, если за блоком есть свободная память, а для крупных
+// блоков, выделенных через mmap, glibc выполняет перенос при помощи mremap без копирования
+template <typename T>
+struct MallocAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "malloc does not guarantee the alignment of T");
+
+    using value_type = T;
+
+    MallocAllocator() = default;
+
+    template <typename U>
+    MallocAllocator(const MallocAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            detail::Throw(std::bad_array_new_length());
+        }
+        void* p = std::malloc(n * sizeof(T));
+        if (p == nullptr) {
+            detail::Throw(std::bad_alloc());
+        }
+        return static_cast<T*>(p);
+    }
+
+    T* try_allocate(size_t n) noexcept {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            return nullptr;
+        }
+        return static_cast<T*>(std::malloc(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t) noexcept {
+        std::free(p);
+    }
+
+    // Переносит блок побайтово, поэтому применяется только к тривиально переносимым элементам
+    T* reallocate(T* p, size_t, size_t new_n) {
+        if (new_n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            detail::Throw(std::bad_array_new_length());
+        }
+        void* new_p = std::realloc(static_cast<void*>(p), new_n * sizeof(T));
+        if (new_p == nullptr) {
+            detail::Throw(std::bad_alloc());
+        }
+        return static_cast<T*>(new_p);
+    }
+
+    template <typename U>
+    bool operator==(const MallocAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const MallocAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+// Аллокатор, выравнивающий каждый блок по границе Alignment байт и дополняющий его размер до кратного
+// Alignment, чтобы векторные инструкции могли обращаться к памяти выровненными загрузками, не выходя
+// за пределы блока. Выравнивание alignof(T) std::allocator соблюдает и сам
+template <typename T, size_t Alignment>
+struct AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "alignment must not be weaker than alignof(T)");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T) - Alignment) {
+            detail::Throw(std::bad_array_new_length());
+        }
+        return static_cast<T*>(::operator new(PaddedSize(n), std::align_val_t{ Alignment }));
+    }
+
+    T* try_allocate(size_t n) noexcept {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T) - Alignment) {
+            return nullptr;
+        }
+        return static_cast<T*>(::operator new(PaddedSize(n), std::align_val_t{ Alignment }, std::nothrow));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        ::operator delete(p, PaddedSize(n), std::align_val_t{ Alignment });
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return false;
+    }
+
+private:
+    static size_t PaddedSize(size_t n) noexcept {
+        return (n * sizeof(T) + Alignment - 1) / Alignment * Alignment;
+    }
+};
+
+template <typename T, typename Alloc = std::allocator<T>>
 class RawMemory {
+    using AllocTraits = std::allocator_traits<Alloc>;
 public:
+    using allocator_type = Alloc;
+
+    // Буфер можно увеличить средствами аллокатора, не перенося элементы конструкторами
+    static constexpr bool CAN_REALLOCATE = IsTriviallyRelocatable<T>::value
+        && (detail::HasTryExpand<Alloc>::value || detail::HasReallocate<Alloc>::value);
+
     RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
+    explicit RawMemory(const Alloc& alloc) noexcept
+        : alloc_(alloc) {
+    }
+
+    explicit RawMemory(size_t capacity, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , buffer_(Allocate(capacity))
         , capacity_(capacity) {
     }
+
+    // Выделяет память, не бросая исключений. Если памяти не хватило, буфер остаётся пустым
+    RawMemory(size_t capacity, const Alloc& alloc, std::nothrow_t) noexcept
+        : alloc_(alloc)
+        , buffer_(TryAllocate(capacity))
+        , capacity_(buffer_ != nullptr ? capacity : 0) {
+    }
     
     RawMemory(const RawMemory&) = delete;
     
     RawMemory& operator=(const RawMemory& rhs) = delete;
     
-    RawMemory(RawMemory&& other) noexcept {
+    RawMemory(RawMemory&& other) noexcept
+        : alloc_(std::move(other.alloc_)) {
         buffer_ = other.buffer_;
         capacity_ = other.capacity_;
         other.buffer_ = nullptr;
@@ -28,7 +377,8 @@ public:
 
     RawMemory& operator=(RawMemory&& rhs) noexcept {
         if (this != &rhs) {
-            buffer_.~RawMemory();
+            Deallocate(buffer_);
+            buffer_ = nullptr;
             capacity_ = 0;
             Swap(rhs);
         }
@@ -59,6 +409,14 @@ public:
     }
 
     void Swap(RawMemory& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+        else {
+            // Буферы можно обменять, только если любой из аллокаторов способен освободить чужой
+            assert(alloc_ == other.alloc_);
+        }
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
@@ -75,44 +433,245 @@ public:
         return capacity_;
     }
 
+    const Alloc& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    // Увеличивает ёмкость до new_capacity, сохраняя содержимое буфера. Сначала пробует расширить
+    // блок на месте, затем перенести его аллокатором. Возвращает false, если аллокатор не умеет ни того,
+    // ни другого — тогда буфер не изменяется
+    bool TryReallocate(size_t new_capacity) {
+        static_assert(IsTriviallyRelocatable<T>::value, "bytewise reallocation requires trivially relocatable T");
+        if (buffer_ == nullptr) {
+            return false;
+        }
+        if (TryExpand(new_capacity)) {
+            return true;
+        }
+        if constexpr (detail::HasReallocate<Alloc>::value) {
+            buffer_ = alloc_.reallocate(buffer_, capacity_, new_capacity);
+            stats::OnGrowInPlace<T>(capacity_, new_capacity);
+            capacity_ = new_capacity;
+            return true;
+        }
+        return false;
+    }
+
+    // Увеличивает ёмкость до new_capacity, расширяя блок на месте. Элементы не перемещаются,
+    // поэтому указатели на них остаются действительными. Возвращает false, если расширить блок
+    // не удалось или аллокатор этого не умеет
+    bool TryExpand(size_t new_capacity) noexcept {
+        assert(new_capacity >= capacity_);
+        if constexpr (detail::HasTryExpand<Alloc>::value) {
+            if (buffer_ != nullptr && alloc_.try_expand(buffer_, capacity_, new_capacity)) {
+                stats::OnGrowInPlace<T>(capacity_, new_capacity);
+                capacity_ = new_capacity;
+                return true;
+            }
+        }
+        return false;
+    }
+
 private:
     // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T* Allocate(size_t n) {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* buf = AllocTraits::allocate(alloc_, n);
+        stats::OnAllocate<T>(n);
+        return buf;
+    }
+
+    // Аналог Allocate, возвращающий nullptr вместо исключения. Память std::allocator выделяется
+    // небросающей формой operator new, которую освобождает и сам std::allocator
+    T* TryAllocate(size_t n) noexcept {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* buf = nullptr;
+        if constexpr (detail::HasTryAllocate<Alloc>::value) {
+            buf = alloc_.try_allocate(n);
+        }
+        else if constexpr (std::is_same_v<Alloc, std::allocator<T>>) {
+            if (n <= std::numeric_limits<size_t>::max() / sizeof(T)) {
+                if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                    buf = static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ alignof(T) }, std::nothrow));
+                }
+                else {
+                    buf = static_cast<T*>(::operator new(n * sizeof(T), std::nothrow));
+                }
+            }
+        }
+        else {
+#if ADVANCED_VECTOR_EXCEPTIONS
+            try {
+                buf = AllocTraits::allocate(alloc_, n);
+            }
+            catch (const std::bad_alloc&) {
+            }
+#else
+            buf = AllocTraits::allocate(alloc_, n);
+#endif
+        }
+        if (buf != nullptr) {
+            stats::OnAllocate<T>(n);
+        }
+        return buf;
     }
 
     // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T* buf) noexcept {
-        operator delete(buf);
+    void Deallocate(T* buf) noexcept {
+        if (buf != nullptr) {
+            AllocTraits::deallocate(alloc_, buf, capacity_);
+            stats::OnDeallocate<T>();
+        }
     }
 
+    Alloc alloc_;
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
-template <typename T>
+// Политики роста ёмкости. NextCapacity возвращает новую ёмкость не меньше required
+// для буфера текущей ёмкости capacity из элементов размера element_size
+
+// Удвоение ёмкости
+struct DoublingGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*element_size*/) noexcept {
+        return std::max(capacity == 0 ? 1 : capacity * 2, required);
+    }
+};
+
+// Рост в полтора раза: сумма ранее освобождённых блоков со временем превышает запрашиваемый,
+// и аллокатор может использовать их повторно
+struct OneAndHalfGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*element_size*/) noexcept {
+        return std::max(capacity + capacity / 2 + 1, required);
+    }
+};
+
+namespace detail {
+
+    // Округляет размер блока вверх до размерного класса, типичного для malloc (jemalloc, tcmalloc):
+    // до 128 байт с шагом 16, далее четыре класса на каждую степень двойки
+    inline size_t RoundUpToSizeClass(size_t bytes) noexcept {
+        if (bytes <= 128) {
+            return (bytes + 15) & ~size_t{ 15 };
+        }
+        size_t power = 128;
+        while (power * 2 < bytes) {
+            power *= 2;
+        }
+        const size_t step = power / 4;
+        return (bytes + step - 1) / step * step;
+    }
+
+}  // namespace detail
+
+// Дополняет ёмкость, выбранную Base, до размерного класса аллокатора: память,
+// которую malloc всё равно выделит, становится доступной вектору
+template <typename Base = DoublingGrowth>
+struct SizeClassGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        const size_t base = Base::NextCapacity(capacity, required, element_size);
+        return std::max(base, detail::RoundUpToSizeClass(base * element_size) / element_size);
+    }
+};
+
+// Первый буфер занимает не меньше MinBytes байт (по умолчанию — одну кэш-линию)
+// и вмещает не меньше MinSize элементов
+template <size_t MinBytes = 64, size_t MinSize = 1, typename Base = DoublingGrowth>
+struct MinCapacityGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        const size_t min_capacity = std::max((MinBytes + element_size - 1) / element_size, MinSize);
+        return std::max(Base::NextCapacity(capacity, required, element_size), min_capacity);
+    }
+};
+
+// Тег конструирования элементов инициализацией по умолчанию: память под тривиальные типы
+// не заполняется, что избавляет от лишнего прохода по буферу, который сразу будет перезаписан
+struct DefaultInitT {
+    explicit DefaultInitT() = default;
+};
+
+inline constexpr DefaultInitT DEFAULT_INIT{};
+
+// Дополняет ёмкость, выбранную Base, так, чтобы буфер занимал целое число блоков по Bytes байт
+template <size_t Bytes, typename Base = DoublingGrowth>
+struct PaddedGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t element_size) noexcept {
+        const size_t base = Base::NextCapacity(capacity, required, element_size);
+        const size_t bytes = (base * element_size + Bytes - 1) / Bytes * Bytes;
+        return std::max(base, bytes / element_size);
+    }
+};
+
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
 class Vector {
+    using AllocTraits = std::allocator_traits<Alloc>;
 public:
     using iterator = T*;
     using const_iterator = const T*;
+    using allocator_type = Alloc;
     
     Vector() = default;
 
-    explicit Vector(size_t size)
-        : data_(size)
+    explicit Vector(const Alloc& alloc) noexcept
+        : data_(alloc) {
+    }
+
+    explicit Vector(size_t size, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
         , size_(size)  //
     {
         std::uninitialized_value_construct_n(data_.GetAddress(), size);
     }
+
+    Vector(size_t size, DefaultInitT, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
+        , size_(size)  //
+    {
+        std::uninitialized_default_construct_n(data_.GetAddress(), size);
+    }
+
+    // Создаёт size элементов, инициализированных значением, в нескольких потоках
+    Vector(size_t size, const ParallelPolicy& policy, const Alloc& alloc = Alloc())
+        : data_(size, alloc) {
+        T* data = data_.GetAddress();
+        detail::ParallelUninitialized(policy, data, size, [data](size_t first, size_t count) {
+            std::uninitialized_value_construct_n(data + first, count);
+        });
+        size_ = size;
+    }
+
+    Vector(std::initializer_list<T> init, const Alloc& alloc = Alloc())
+        : data_(init.size(), alloc)
+        , size_(init.size())  //
+    {
+        detail::UninitializedCopyN(init.begin(), size_, data_.GetAddress());
+    }
     
     Vector(const Vector& other)
-        : data_(other.size_)
+        : Vector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+    }
+
+    Vector(const Vector& other, const Alloc& alloc)
+        : data_(other.size_, alloc)
         , size_(other.size_)  //
     {
         std::uninitialized_copy_n(other.data_.GetAddress(), size_, data_.GetAddress());
     }
+
+    // Копирует элементы other в нескольких потоках
+    Vector(const Vector& other, const ParallelPolicy& policy)
+        : data_(other.size_, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+        CopyFrom(other, data_, policy);
+        size_ = other.size_;
+    }
     
-    Vector(Vector&& other) noexcept {
+    Vector(Vector&& other) noexcept
+        : data_(other.GetAllocator()) {
         Swap(other);
     }
     
@@ -120,7 +679,7 @@ public:
         if (this != &rhs) {
             if (rhs.size_ > data_.Capacity()) {
                 /* Применить copy-and-swap */
-                Vector rhs_copy(rhs);
+                Vector rhs_copy(rhs, GetAllocator());
                 Swap(rhs_copy);
             }
             else {
@@ -129,7 +688,7 @@ public:
                 auto count = std::min(rhs.size_, size_);
                 std::copy(rhs.data_.GetAddress(), rhs.data_.GetAddress() + count, data_.GetAddress());
                 if (rhs.size_ < size_) {
-                    std::destroy_n(data_.GetAddress() + rhs.size_, size_ - rhs.size_);
+                    detail::DestroyN(data_.GetAddress() + rhs.size_, size_ - rhs.size_);
                 }
                 else {
                     std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_);
@@ -140,20 +699,75 @@ public:
         return *this;
     }
     
-    Vector& operator=(Vector&& rhs) noexcept {
+    Vector& operator=(Vector&& rhs) noexcept(AllocTraits::is_always_equal::value) {
         if (this != &rhs) {
-            Swap(rhs);
+            if (AllocTraits::is_always_equal::value || GetAllocator() == rhs.GetAllocator()) {
+                Swap(rhs);
+            }
+            else {
+                /* Чужой буфер нельзя освободить нашим аллокатором — переносим элементы поштучно */
+                RawMemory<T, Alloc> new_data(rhs.size_, GetAllocator());
+                std::uninitialized_move_n(rhs.data_.GetAddress(), rhs.size_, new_data.GetAddress());
+                detail::DestroyN(data_.GetAddress(), size_);
+                data_.Swap(new_data);
+                size_ = rhs.size_;
+            }
         }
         return *this;
     }
 
+    // Копирующее присваивание, при котором копирование новых и разрушение старых элементов
+    // выполняются в нескольких потоках. При исключении вектор не изменяется
+    void Assign(const Vector& rhs, const ParallelPolicy& policy) {
+        if (this == &rhs) {
+            return;
+        }
+        RawMemory<T, Alloc> new_data(rhs.size_, GetAllocator());
+        CopyFrom(rhs, new_data, policy);
+        Clear(policy);
+        data_.Swap(new_data);
+        size_ = rhs.size_;
+    }
+
+    // Перемещающее присваивание, сохраняющее буфер: если элементы rhs помещаются в текущую ёмкость,
+    // они перемещаются в неё поэлементно, и буфер не освобождается. rhs остаётся пустым и тоже
+    // сохраняет свой буфер, поэтому переиспользуемые рабочие векторы не обращаются к аллокатору
+    void AssignKeepCapacity(Vector&& rhs) {
+        if (this == &rhs) {
+            return;
+        }
+        if (rhs.size_ > Capacity()) {
+            *this = std::move(rhs);
+        }
+        else {
+            const size_t count = std::min(rhs.size_, size_);
+            std::move(rhs.begin(), rhs.begin() + count, begin());
+            if (rhs.size_ < size_) {
+                detail::DestroyN(begin() + rhs.size_, size_ - rhs.size_);
+            }
+            else {
+                std::uninitialized_move_n(rhs.begin() + size_, rhs.size_ - size_, end());
+            }
+            size_ = rhs.size_;
+        }
+        rhs.Clear();
+    }
+
+    // Перемещающее присваивание, при котором прежние элементы разрушаются в потоке reclaimer
+    void Assign(Vector&& rhs, BackgroundReclaimer& reclaimer) {
+        if (this != &rhs) {
+            ClearAndRelease(reclaimer);
+            *this = std::move(rhs);
+        }
+    }
+
     void Swap(Vector& other) noexcept {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
     }
     
     ~Vector() {
-        std::destroy_n(data_.GetAddress(), size_);
+        detail::DestroyN(data_.GetAddress(), size_);
     }
     
     
@@ -182,6 +796,7 @@ public:
         iterator result = nullptr;
         size_t count = pos - begin();
         if (size_ == Capacity()) {
+            stats::OnReallocate<T>(stats::ReallocationCause::EMPLACE);
             result = ReAllocateEmplace(count, std::forward<Args>(args)...);
         }
         else {
@@ -193,10 +808,33 @@ public:
     iterator Erase(const_iterator pos) noexcept {
         assert(pos >= begin() && pos < end());
         size_t count = pos - begin();
-        std::move_backward(begin() + count + 1, end(), end() - 1);
-        PopBack();
+        detail::EraseShift(data_.GetAddress(), size_, count);
+        --size_;
         return begin() + count;
     }
+
+    // Удаляет элементы [first, last), сдвигая хвост один раз
+    iterator Erase(const_iterator first, const_iterator last) noexcept {
+        assert(first >= begin() && first <= last && last <= end());
+        size_t count = first - begin();
+        if (first != last) {
+            const size_t erased = last - first;
+            detail::EraseShift(data_.GetAddress(), size_, count, erased);
+            size_ -= erased;
+        }
+        return begin() + count;
+    }
+
+    // Удаляет за один проход все элементы, удовлетворяющие pred, и возвращает их количество.
+    // Оставшиеся элементы сохраняют взаимный порядок
+    template <typename Predicate>
+    size_t EraseIf(Predicate pred) {
+        iterator new_end = std::remove_if(begin(), end(), pred);
+        const size_t erased = end() - new_end;
+        detail::DestroyN(new_end, erased);
+        size_ -= erased;
+        return erased;
+    }
     
     iterator Insert(const_iterator pos, const T& value) {
         return Emplace(pos, value);
@@ -204,16 +842,160 @@ public:
     iterator Insert(const_iterator pos, T&& value) {
         return Emplace(pos, std::move(value));
     }
+
+    // Вставляет count копий value. value может ссылаться на элемент самого вектора
+    iterator Insert(const_iterator pos, size_t count, const T& value) {
+        assert(pos >= begin() && pos <= end());
+        size_t index = pos - begin();
+        InsertN(index, count, [&value, count](T* to) {
+            std::uninitialized_fill_n(to, count, value);
+        });
+        return begin() + index;
+    }
+
+    // Вставляет элементы диапазона [first, last), который не должен указывать на элементы самого вектора.
+    // Для однонаправленных итераторов память выделяется не более одного раза, а хвост сдвигается однократно
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+        assert(pos >= begin() && pos <= end());
+        size_t index = pos - begin();
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if constexpr (detail::IS_MEMCPY_SOURCE<T, InputIt>) {
+                if (size_ + count <= Capacity()) {
+                    detail::RelocateOverlappingN(begin() + index, size_ - index, begin() + index + count);
+                    detail::UninitializedCopyN(first, count, begin() + index);
+                    size_ += count;
+                    return begin() + index;
+                }
+            }
+            InsertN(index, count, [first, count](T* to) {
+                detail::UninitializedCopyN(first, count, to);
+            });
+        }
+        else {
+            /* Длина однопроходного диапазона заранее неизвестна: элементы добавляются в конец
+               и затем за один проход переставляются на место */
+            const size_t old_size = size_;
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+            std::rotate(begin() + index, begin() + old_size, end());
+        }
+        return begin() + index;
+    }
+
+    iterator Insert(const_iterator pos, std::initializer_list<T> init) {
+        return Insert(pos, init.begin(), init.end());
+    }
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void Append(InputIt first, InputIt last) {
+        Insert(end(), first, last);
+    }
     
     void Reserve(size_t new_capacity) {
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
+        stats::OnReallocate<T>(stats::ReallocationCause::RESERVE);
+        GrowTo(new_capacity);
+    }
+
+    // Аналог Reserve, сообщающий о нехватке памяти результатом вместо исключения.
+    // Если памяти не хватило, вектор не изменяется
+    [[nodiscard]] bool TryReserve(size_t new_capacity) {
+        if (new_capacity <= data_.Capacity()) {
+            return true;
+        }
+        if (data_.TryExpand(new_capacity)) {
+            return true;
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, GetAllocator(), std::nothrow);
+        if (new_data.GetAddress() == nullptr) {
+            return false;
+        }
+        stats::OnReallocate<T>(stats::ReallocationCause::RESERVE);
         InitOnConstruct(new_data);
-        std::destroy_n(data_.GetAddress(), size_);
+        data_.Swap(new_data);
+        return true;
+    }
+
+    // Уменьшает ёмкость до размера вектора. Элементы переносятся так же, как при Reserve,
+    // поэтому при исключении вектор остаётся прежним
+    void ShrinkToFit() {
+        if (size_ == Capacity()) {
+            return;
+        }
+        stats::OnReallocate<T>(stats::ReallocationCause::SHRINK_TO_FIT);
+        RawMemory<T, Alloc> new_data(size_, GetAllocator());
+        InitOnConstruct(new_data);
+        data_.Swap(new_data);
+    }
+
+    // Аналог Reserve, переносящий элементы в нескольких потоках
+    void Reserve(size_t new_capacity, const ParallelPolicy& policy) {
+        if (new_capacity <= data_.Capacity()) {
+            return;
+        }
+        stats::OnReallocate<T>(stats::ReallocationCause::RESERVE);
+        RawMemory<T, Alloc> new_data(new_capacity, GetAllocator());
+        T* from = data_.GetAddress();
+        T* to = new_data.GetAddress();
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            std::vector<size_t> bounds;
+            detail::ParallelFor(policy, size_, [from, to](size_t first, size_t count) {
+                detail::UninitializedRelocateN(from + first, count, to + first);
+            }, bounds);
+        }
+        else {
+            detail::ParallelUninitialized(policy, to, size_, [from, to](size_t first, size_t count) {
+                detail::UninitializedMoveOrCopyN(from + first, count, to + first);
+            });
+            detail::ParallelDestroy(policy, from, size_);
+        }
         data_.Swap(new_data);
     }
+
+    // Удаляет все элементы в нескольких потоках, сохраняя ёмкость
+    void Clear(const ParallelPolicy& policy) noexcept {
+        detail::ParallelDestroy(policy, data_.GetAddress(), size_);
+        size_ = 0;
+    }
+
+    // Удаляет все элементы, сохраняя ёмкость
+    void Clear() noexcept {
+        detail::DestroyN(data_.GetAddress(), size_);
+        size_ = 0;
+    }
+
+    // Удаляет все элементы и освобождает память
+    void ClearAndRelease() noexcept {
+        Clear();
+        RawMemory<T, Alloc> empty(GetAllocator());
+        data_.Swap(empty);
+    }
+
+    // Отдаёт буфер вместе с элементами потоку reclaimer, который разрушит их и освободит память.
+    // Вектор остаётся пустым и без буфера. Если передать буфер не удалось, элементы разрушаются
+    // в вызывающем потоке. Элементы с тривиальным деструктором разрушать не нужно, и их буфер
+    // освобождается сразу
+    void ClearAndRelease(BackgroundReclaimer& reclaimer) noexcept {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            ClearAndRelease();
+        }
+        else {
+            Garbage* garbage = new (std::nothrow) Garbage{ RawMemory<T, Alloc>(GetAllocator()), 0 };
+            if (garbage == nullptr) {
+                ClearAndRelease();
+                return;
+            }
+            garbage->data.Swap(data_);
+            garbage->size = std::exchange(size_, 0);
+            Defer(garbage, reclaimer);
+        }
+    }
     
     void Resize(size_t new_size) {
         if (new_size > size_) {
@@ -221,10 +1003,47 @@ public:
             std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_);
         }
         else {
-            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            detail::DestroyN(data_.GetAddress() + new_size, size_ - new_size);
         }   
         size_ = new_size;
     }
+
+    // Аналог Resize, при котором лишние элементы разрушаются в потоке reclaimer. Они переносятся
+    // в отдельный буфер, поэтому способ подходит типам с дешёвым переносом и дорогим деструктором.
+    // Если перенос может бросить исключение или память под буфер не выделилась, элементы
+    // разрушаются в вызывающем потоке
+    void Resize(size_t new_size, BackgroundReclaimer& reclaimer) {
+        if constexpr (!std::is_trivially_destructible_v<T>
+            && (IsTriviallyRelocatable<T>::value || std::is_nothrow_move_constructible_v<T>)) {
+            if (new_size < size_) {
+                const size_t count = size_ - new_size;
+                Garbage* garbage = new (std::nothrow) Garbage{
+                    RawMemory<T, Alloc>(count, GetAllocator(), std::nothrow), 0 };
+                if (garbage != nullptr && garbage->data.Capacity() == count) {
+                    detail::UninitializedRelocateN(data_ + new_size, count, garbage->data.GetAddress());
+                    garbage->size = count;
+                    size_ = new_size;
+                    Defer(garbage, reclaimer);
+                    return;
+                }
+                delete garbage;
+            }
+        }
+        Resize(new_size);
+    }
+
+    // Аналог Resize, но новые элементы инициализируются по умолчанию, и значения тривиальных типов
+    // остаются неопределёнными
+    void ResizeUninitialized(size_t new_size) {
+        if (new_size > size_) {
+            Reserve(new_size);
+            std::uninitialized_default_construct_n(data_.GetAddress() + size_, new_size - size_);
+        }
+        else {
+            detail::DestroyN(data_.GetAddress() + new_size, size_ - new_size);
+        }
+        size_ = new_size;
+    }
     
     template <typename Type>
     void PushBack(Type&& value) {
@@ -235,11 +1054,8 @@ public:
     T& EmplaceBack(Args&&... args) {
         T* result = nullptr;
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-            result = new (new_data + size_) T(std::forward<Args>(args)...);
-            InitOnConstruct(new_data);
-            std::destroy_n(data_.GetAddress(), size_);
-            data_.Swap(new_data);
+            stats::OnReallocate<T>(stats::ReallocationCause::EMPLACE_BACK);
+            result = ReAllocateEmplace(size_, std::forward<Args>(args)...);
         }
         else {
             result = new (data_ + size_) T(std::forward<Args>(args)...);
@@ -247,10 +1063,31 @@ public:
         ++size_;
         return *result;
     }
+
+    // Аналог EmplaceBack, который при нехватке памяти возвращает nullptr вместо исключения
+    // и оставляет вектор неизменным. Исключения конструктора T по-прежнему пробрасываются
+    template <typename... Args>
+    T* TryEmplaceBack(Args&&... args) {
+        if (size_ == Capacity() && !data_.TryExpand(NextCapacity())) {
+            RawMemory<T, Alloc> new_data(NextCapacity(), GetAllocator(), std::nothrow);
+            if (new_data.GetAddress() == nullptr) {
+                return nullptr;
+            }
+            stats::OnReallocate<T>(stats::ReallocationCause::EMPLACE_BACK);
+            T* result = detail::RelocateAndEmplace(data_.GetAddress(), size_, size_, new_data.GetAddress(),
+                std::forward<Args>(args)...);
+            data_.Swap(new_data);
+            ++size_;
+            return result;
+        }
+        T* result = new (data_ + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return result;
+    }
     
     void PopBack() noexcept {
         if (size_ > 0) {
-            std::destroy_at(data_.GetAddress() + size_ - 1);
+            detail::DestroyAt(data_.GetAddress() + size_ - 1);
             --size_;
         }
     }
@@ -263,6 +1100,10 @@ public:
         return data_.Capacity();
     }
 
+    const Alloc& GetAllocator() const noexcept {
+        return data_.GetAllocator();
+    }
+
     const T& operator[](size_t index) const noexcept {
         return const_cast<Vector&>(*this)[index];
     }
@@ -274,56 +1115,143 @@ public:
 
 private: 
 
-    void InitOnConstruct(RawMemory<T>& new_data) {
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+    // Буфер с элементами, отделённый от вектора. Элементы разрушаются вместе с ним
+    struct Garbage {
+        ~Garbage() {
+            detail::DestroyN(data.GetAddress(), size);
         }
-        else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+
+        RawMemory<T, Alloc> data;
+        size_t size;
+    };
+
+    static void Defer(Garbage* garbage, BackgroundReclaimer& reclaimer) noexcept {
+        if (!reclaimer.Submit(garbage, [](void* p) noexcept {
+            delete static_cast<Garbage*>(p);
+        })) {
+            delete garbage;
         }
     }
 
-    template <typename... Args>
-    iterator ReAllocateEmplace(size_t count, Args&&... args) {
-        iterator result = nullptr;
-        RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-        result = new (new_data + count) T(std::forward<Args>(args)...);
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), count, new_data.GetAddress());
-            std::uninitialized_move_n(begin() + count, size_ - count, new_data.GetAddress() + count + 1);
+    // Ёмкость буфера, в который переезжает заполненный вектор при вставке
+    size_t NextCapacity() const noexcept {
+        return Growth::NextCapacity(Capacity(), size_ + 1, sizeof(T));
+    }
+
+    // Копирует элементы other в неинициализированный буфер to в нескольких потоках
+    static void CopyFrom(const Vector& other, RawMemory<T, Alloc>& to, const ParallelPolicy& policy) {
+        const T* from = other.data_.GetAddress();
+        T* data = to.GetAddress();
+        detail::ParallelUninitialized(policy, data, other.size_, [from, data](size_t first, size_t count) {
+            detail::UninitializedCopyN(from + first, count, data + first);
+        });
+    }
+
+    // Вставляет count элементов в позицию index. construct(T* to) создаёт их в неинициализированной
+    // памяти; до его успешного завершения вектор не изменяется. Если без выделения памяти
+    // бросает исключение перестановка элементов на место, вектор сохраняет все старые и новые
+    // элементы в неопределённом порядке
+    template <typename Construct>
+    void InsertN(size_t index, size_t count, Construct construct) {
+        if (count == 0) {
+            return;
+        }
+        if (size_ + count > Capacity()) {
+            stats::OnReallocate<T>(stats::ReallocationCause::INSERT);
+            RawMemory<T, Alloc> new_data(Growth::NextCapacity(Capacity(), size_ + count, sizeof(T)), GetAllocator());
+            construct(new_data + index);
+            ADVANCED_VECTOR_TRY {
+                detail::RelocateAround(data_.GetAddress(), size_, index, count, new_data.GetAddress());
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                detail::DestroyN(new_data + index, count);
+                ADVANCED_VECTOR_RETHROW;
+            }
+            data_.Swap(new_data);
         }
         else {
-            try {
-                std::uninitialized_copy_n(begin(), count, new_data.GetAddress());
-                std::uninitialized_copy_n(begin() + count, size_ - count, new_data.GetAddress() + count + 1);
+            construct(end());
+            if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+                && std::is_nothrow_swappable_v<T>) {
+                std::rotate(begin() + index, end(), end() + count);
             }
-            catch (...) {
-                std::destroy_n(new_data.GetAddress() + count, 1);
-                throw;
+            else {
+                ADVANCED_VECTOR_TRY {
+                    std::rotate(begin() + index, end(), end() + count);
+                }
+                ADVANCED_VECTOR_CATCH_ALL {
+                    /* Созданные за концом элементы остаются во владении вектора */
+                    size_ += count;
+                    ADVANCED_VECTOR_RETHROW;
+                }
             }
         }
-        std::destroy_n(data_.GetAddress(), size_);
+        size_ += count;
+    }
+
+    // Переносит элементы в new_data; старые элементы после этого разрушены
+    void InitOnConstruct(RawMemory<T, Alloc>& new_data) {
+        detail::UninitializedRelocateN(data_.GetAddress(), size_, new_data.GetAddress());
+    }
+
+    // Увеличивает ёмкость до new_capacity, по возможности без выделения нового буфера
+    void GrowTo(size_t new_capacity) {
+        if constexpr (RawMemory<T, Alloc>::CAN_REALLOCATE) {
+            if (data_.TryReallocate(new_capacity)) {
+                return;
+            }
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, GetAllocator());
+        InitOnConstruct(new_data);
         data_.Swap(new_data);
-        return result;
     }
 
+    // Вставка с ростом буфера средствами аллокатора. Элемент создаётся заранее во временной памяти:
+    // после realloc ссылки из args на элементы вектора становятся недействительными
     template <typename... Args>
-    iterator NoAllocateEmplace(size_t count, Args&&... args) {
-        iterator result = nullptr;
-        if (size_ != 0) {
-            new (data_ + size_) T(std::move(*(end() - 1)));
-            try {
-                std::move_backward(begin() + count, end(), end() + 1);
-            }
-            catch (...) {
-                std::destroy_n(end(), 1);
-                throw;
-            }
-            std::destroy_at(begin() + count);
+    iterator GrowInPlaceEmplace(size_t count, size_t new_capacity, Args&&... args) {
+        alignas(T) unsigned char slot[sizeof(T)];
+        T* value = new (slot) T(std::forward<Args>(args)...);
+        ADVANCED_VECTOR_TRY {
+            GrowTo(new_capacity);
+        }
+        ADVANCED_VECTOR_CATCH_ALL {
+            detail::DestroyAt(value);
+            ADVANCED_VECTOR_RETHROW;
         }
-        result = new (data_ + count) T(std::forward<Args>(args)...);
+        detail::RelocateOverlappingN(begin() + count, size_ - count, begin() + count + 1);
+        detail::UninitializedRelocateN(value, 1, begin() + count);
+        return begin() + count;
+    }
+
+    template <typename... Args>
+    iterator ReAllocateEmplace(size_t count, Args&&... args) {
+        if constexpr (RawMemory<T, Alloc>::CAN_REALLOCATE) {
+            return GrowInPlaceEmplace(count, NextCapacity(), std::forward<Args>(args)...);
+        }
+        RawMemory<T, Alloc> new_data(NextCapacity(), GetAllocator());
+        iterator result = detail::RelocateAndEmplace(data_.GetAddress(), size_, count, new_data.GetAddress(),
+            std::forward<Args>(args)...);
+        data_.Swap(new_data);
         return result;
     }
-    RawMemory<T> data_;
+
+    template <typename... Args>
+    iterator NoAllocateEmplace(size_t count, Args&&... args) {
+        return detail::EmplaceShift(data_.GetAddress(), size_, count, std::forward<Args>(args)...);
+    }
+
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
-};
\ No newline at end of file
+};
+
+// Вектор, начало буфера которого выровнено по границе Alignment байт, а ёмкость при росте
+// дополняется до целого числа блоков такого размера
+template <typename T, size_t Alignment>
+using AlignedVector = Vector<T, AlignedAllocator<T, Alignment>, PaddedGrowth<Alignment>>;
+
+namespace pmr {
+    // Вектор, память которого выделяется из std::pmr::memory_resource
+    template <typename T>
+    using Vector = ::Vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdlib>
+#include <new>
+
+// Поддержка сборки с отключёнными исключениями (-fno-exceptions). Без исключений блоки
+// ADVANCED_VECTOR_TRY выполняются без перехвата, обработчики ADVANCED_VECTOR_CATCH_ALL
+// не выполняются никогда, а ошибки, о которых сообщают исключения, завершают программу.
+// Сообщить о нехватке памяти без исключений позволяют TryReserve и TryEmplaceBack
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define ADVANCED_VECTOR_EXCEPTIONS 1
+#define ADVANCED_VECTOR_TRY try
+#define ADVANCED_VECTOR_CATCH_ALL catch (...)
+#define ADVANCED_VECTOR_RETHROW throw
+#else
+#define ADVANCED_VECTOR_EXCEPTIONS 0
+#define ADVANCED_VECTOR_TRY if (true)
+#define ADVANCED_VECTOR_CATCH_ALL if (false)
+#define ADVANCED_VECTOR_RETHROW ((void)0)
+#endif
+
+namespace detail {
+
+    // Бросает исключение error, а при отключённых исключениях завершает программу
+    template <typename Exception>
+    [[noreturn]] void Throw(const Exception& error) {
+#if ADVANCED_VECTOR_EXCEPTIONS
+        throw error;
+#else
+        (void)error;
+        std::abort();
+#endif
+    }
+
+}  // namespace detail
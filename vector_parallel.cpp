@@ -0,0 +1,102 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "vector_exceptions.cpp"
+
+// Параметры многопоточного выполнения массовых операций над элементами вектора.
+// Диапазон делится между потоками, если на каждый приходится хотя бы min_elements_per_thread элементов
+struct ParallelPolicy {
+    size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t min_elements_per_thread = size_t{ 1 } << 16;
+};
+
+namespace detail {
+
+    // Выполняет action(first, count) для непересекающихся частей диапазона [0, size) из нескольких потоков.
+    // Одну часть обрабатывает вызывающий поток. Возвращает границы частей и исключения,
+    // выброшенные при их обработке
+    template <typename Action>
+    std::vector<std::exception_ptr> ParallelFor(const ParallelPolicy& policy, size_t size, Action action,
+        std::vector<size_t>& bounds) {
+        const size_t per_thread = std::max<size_t>(policy.min_elements_per_thread, 1);
+        const size_t num_parts = std::max<size_t>(1, std::min(policy.num_threads, size / per_thread));
+        bounds.resize(num_parts + 1);
+        for (size_t part = 0; part <= num_parts; ++part) {
+            bounds[part] = size / num_parts * part + std::min(part, size % num_parts);
+        }
+        std::vector<std::exception_ptr> errors(num_parts);
+        auto run = [&](size_t part) {
+            ADVANCED_VECTOR_TRY {
+                action(bounds[part], bounds[part + 1] - bounds[part]);
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                errors[part] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(num_parts - 1);
+        ADVANCED_VECTOR_TRY {
+            for (size_t part = 1; part < num_parts; ++part) {
+                threads.emplace_back(run, part);
+            }
+        }
+        ADVANCED_VECTOR_CATCH_ALL {
+            /* Потоки, которые не удалось запустить, обрабатываются вызывающим */
+            for (size_t part = threads.size() + 1; part < num_parts; ++part) {
+                run(part);
+            }
+        }
+        run(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return errors;
+    }
+
+    // Создаёт size элементов в неинициализированной памяти to, вызывая construct(first, count)
+    // для частей диапазона из нескольких потоков. construct создаёт элементы to[first, first + count)
+    // и при исключении разрушает уже созданные. Если хотя бы одна часть завершилась исключением,
+    // элементы остальных частей разрушаются, а первое исключение пробрасывается
+    template <typename T, typename Construct>
+    void ParallelUninitialized(const ParallelPolicy& policy, T* to, size_t size, Construct construct) {
+        std::vector<size_t> bounds;
+        const auto errors = ParallelFor(policy, size, construct, bounds);
+        std::exception_ptr error;
+        for (size_t part = 0; part < errors.size(); ++part) {
+            if (errors[part] && !error) {
+                error = errors[part];
+            }
+        }
+        if (error) {
+            for (size_t part = 0; part < errors.size(); ++part) {
+                if (!errors[part]) {
+                    std::destroy_n(to + bounds[part], bounds[part + 1] - bounds[part]);
+                }
+            }
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Разрушает size элементов, начиная с data, из нескольких потоков
+    template <typename T>
+    void ParallelDestroy(const ParallelPolicy& policy, T* data, size_t size) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::vector<size_t> bounds;
+            ADVANCED_VECTOR_TRY {
+                ParallelFor(policy, size, [data](size_t first, size_t count) {
+                    std::destroy_n(data + first, count);
+                }, bounds);
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                /* Не удалось выделить память под служебные структуры */
+                std::destroy_n(data, size);
+            }
+        }
+    }
+
+}  // namespace detail
@@ -0,0 +1,100 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vector_exceptions.cpp"
+
+// Фоновый поток, которому векторы передают буферы с ненужными элементами. Дорогие деструкторы
+// и освобождение памяти выполняются в нём, а не в потоке, который очистил вектор.
+// Передача занимает одно короткое взятие мьютекса. Разрушение объекта дожидается всех
+// переданных буферов
+class BackgroundReclaimer {
+public:
+    using Reclaim = void (*)(void* garbage) noexcept;
+
+    BackgroundReclaimer()
+        : thread_([this] {
+            Run();
+        }) {
+    }
+
+    BackgroundReclaimer(const BackgroundReclaimer&) = delete;
+    BackgroundReclaimer& operator=(const BackgroundReclaimer&) = delete;
+
+    ~BackgroundReclaimer() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        has_tasks_.notify_one();
+        thread_.join();
+    }
+
+    // Ставит в очередь вызов reclaim(garbage). Возвращает false, если очередь не удалось увеличить,
+    // — тогда вызывающий освобождает garbage сам
+    bool Submit(void* garbage, Reclaim reclaim) noexcept {
+        {
+            std::lock_guard lock(mutex_);
+            ADVANCED_VECTOR_TRY {
+                tasks_.push_back({ garbage, reclaim });
+            }
+            ADVANCED_VECTOR_CATCH_ALL {
+                return false;
+            }
+            ++submitted_;
+        }
+        has_tasks_.notify_one();
+        return true;
+    }
+
+    // Дожидается освобождения всего, что было передано до вызова
+    void Flush() {
+        std::unique_lock lock(mutex_);
+        const size_t target = submitted_;
+        done_.wait(lock, [this, target] {
+            return completed_ >= target;
+        });
+    }
+
+private:
+    struct Task {
+        void* garbage;
+        Reclaim reclaim;
+    };
+
+    // Забирает очередь целиком и выполняет её без мьютекса, чтобы Submit не ждал деструкторов
+    void Run() {
+        std::vector<Task> batch;
+        std::unique_lock lock(mutex_);
+        while (true) {
+            has_tasks_.wait(lock, [this] {
+                return stopping_ || !tasks_.empty();
+            });
+            if (tasks_.empty()) {
+                return;
+            }
+            batch.swap(tasks_);
+            lock.unlock();
+            for (const Task& task : batch) {
+                task.reclaim(task.garbage);
+            }
+            const size_t count = batch.size();
+            batch.clear();
+            lock.lock();
+            completed_ += count;
+            done_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable has_tasks_;
+    std::condition_variable done_;
+    std::vector<Task> tasks_;
+    size_t submitted_ = 0;
+    size_t completed_ = 0;
+    bool stopping_ = false;
+    std::thread thread_;
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include "vector.cpp"
+#include "vector_view.cpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Идентификатор типа элемента в заголовке сериализованного вектора. Для арифметических типов
+// вычисляется автоматически, для собственных типов его задают специализацией
+template <typename T, typename = void>
+struct SerializationTypeTag {
+    static constexpr uint32_t value = 0;
+};
+
+template <typename T>
+struct SerializationTypeTag<T, std::enable_if_t<std::is_arithmetic_v<T>>> {
+    static constexpr uint32_t value = (std::is_floating_point_v<T> ? 0x300u : std::is_signed_v<T> ? 0x200u : 0x100u)
+        | static_cast<uint32_t>(sizeof(T));
+};
+
+namespace detail {
+
+    struct SerializedVectorHeader {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t little_endian;
+        uint16_t reserved;
+        uint32_t type_tag;
+        uint32_t element_size;
+        uint64_t count;
+    };
+
+    inline constexpr uint32_t SERIALIZED_VECTOR_MAGIC = 0x43455641;  // "AVEC"
+    inline constexpr uint8_t SERIALIZED_VECTOR_VERSION = 1;
+
+    inline bool IsLittleEndian() noexcept {
+        const uint16_t probe = 1;
+        return *reinterpret_cast<const uint8_t*>(&probe) == 1;
+    }
+
+    // Записывает все буферы iov, повторяя writev после частичной записи
+    inline void WriteAll(int fd, iovec* iov, int count) {
+        while (count > 0) {
+            const ssize_t written = writev(fd, iov, count);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "cannot write vector");
+            }
+            size_t left = static_cast<size_t>(written);
+            while (count > 0 && left >= iov->iov_len) {
+                left -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+            }
+        }
+    }
+
+    inline void ReadAll(int fd, void* data, size_t size) {
+        auto* out = static_cast<char*>(data);
+        while (size > 0) {
+            const ssize_t was_read = read(fd, out, size);
+            if (was_read < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "cannot read vector");
+            }
+            if (was_read == 0) {
+                throw std::runtime_error("unexpected end of serialized vector");
+            }
+            out += was_read;
+            size -= static_cast<size_t>(was_read);
+        }
+    }
+
+}  // namespace detail
+
+// Записывает элементы в дескриптор fd одним вызовом writev: заголовок с типом, размером элемента,
+// количеством элементов и порядком байт, затем содержимое буфера как есть
+template <typename T>
+void WriteVector(int fd, VectorView<const T> elements) {
+    static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable elements are written as raw bytes");
+    detail::SerializedVectorHeader header{ detail::SERIALIZED_VECTOR_MAGIC, detail::SERIALIZED_VECTOR_VERSION,
+        static_cast<uint8_t>(detail::IsLittleEndian()), 0, SerializationTypeTag<T>::value,
+        static_cast<uint32_t>(sizeof(T)), elements.Size() };
+    iovec iov[2] = {
+        { &header, sizeof(header) },
+        { const_cast<T*>(elements.GetAddress()), elements.Size() * sizeof(T) },
+    };
+    detail::WriteAll(fd, iov, elements.IsEmpty() ? 1 : 2);
+}
+
+template <typename T, typename Alloc, typename Growth>
+void WriteVector(int fd, const Vector<T, Alloc, Growth>& v) {
+    WriteVector<T>(fd, VectorView<const T>(v));
+}
+
+// Читает вектор, записанный WriteVector, заменяя содержимое v. Элементы читаются прямо в буфер
+// вектора, без промежуточного копирования. Если прочитать элементы не удалось, v очищается
+template <typename T, typename Alloc, typename Growth>
+void ReadVector(int fd, Vector<T, Alloc, Growth>& v) {
+    static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable elements are read as raw bytes");
+    detail::SerializedVectorHeader header{};
+    detail::ReadAll(fd, &header, sizeof(header));
+    if (header.magic != detail::SERIALIZED_VECTOR_MAGIC || header.version != detail::SERIALIZED_VECTOR_VERSION) {
+        throw std::runtime_error("not a serialized vector");
+    }
+    if (header.little_endian != static_cast<uint8_t>(detail::IsLittleEndian())) {
+        throw std::runtime_error("serialized vector has a different byte order");
+    }
+    if (header.type_tag != SerializationTypeTag<T>::value || header.element_size != sizeof(T)) {
+        throw std::runtime_error("serialized vector holds another element type");
+    }
+    if (header.count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::length_error("serialized vector is too large");
+    }
+    v.ResizeUninitialized(static_cast<size_t>(header.count));
+    try {
+        detail::ReadAll(fd, v.begin(), v.Size() * sizeof(T));
+    }
+    catch (...) {
+        v.Clear();
+        throw;
+    }
+}
+
+#endif
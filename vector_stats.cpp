@@ -0,0 +1,182 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <typeinfo>
+
+// Сбор статистики выделений памяти и переносов элементов для RawMemory, Vector и контейнеров
+// на их основе. Включается макросом ADVANCED_VECTOR_STATS; без него обработчики событий пусты
+// и вызовы не попадают в код
+namespace stats {
+
+#ifdef ADVANCED_VECTOR_STATS
+    inline constexpr bool ENABLED = true;
+#else
+    inline constexpr bool ENABLED = false;
+#endif
+
+    // Операция, из-за которой вектору потребовался новый буфер
+    enum class ReallocationCause {
+        EMPLACE_BACK,
+        EMPLACE,
+        INSERT,
+        RESERVE,
+        SHRINK_TO_FIT,
+    };
+
+    // Счётчики событий для одного типа элементов. Экземпляры регистрируются в общем списке,
+    // который выводит Dump
+    struct Counters {
+        explicit Counters(const char* type_name) noexcept
+            : type_name(type_name)
+            , next(head.load(std::memory_order_relaxed)) {
+            while (!head.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        Counters(const Counters&) = delete;
+        Counters& operator=(const Counters&) = delete;
+
+        void Reset() noexcept {
+            for (auto* counter : { &allocations, &deallocations, &bytes_allocated, &in_place_growths,
+                     &emplace_back_reallocations, &emplace_reallocations, &insert_reallocations,
+                     &reserve_reallocations, &shrink_reallocations, &elements_relocated_bitwise,
+                     &elements_moved, &elements_copied, &peak_capacity }) {
+                counter->store(0, std::memory_order_relaxed);
+            }
+        }
+
+        const char* type_name;
+        std::atomic<size_t> allocations{ 0 };
+        std::atomic<size_t> deallocations{ 0 };
+        std::atomic<size_t> bytes_allocated{ 0 };
+        std::atomic<size_t> in_place_growths{ 0 };
+        std::atomic<size_t> emplace_back_reallocations{ 0 };
+        std::atomic<size_t> emplace_reallocations{ 0 };
+        std::atomic<size_t> insert_reallocations{ 0 };
+        std::atomic<size_t> reserve_reallocations{ 0 };
+        std::atomic<size_t> shrink_reallocations{ 0 };
+        std::atomic<size_t> elements_relocated_bitwise{ 0 };
+        std::atomic<size_t> elements_moved{ 0 };
+        std::atomic<size_t> elements_copied{ 0 };
+        std::atomic<size_t> peak_capacity{ 0 };
+        Counters* next;
+
+        static inline std::atomic<Counters*> head{ nullptr };
+    };
+
+    template <typename T>
+    Counters& CountersFor() noexcept {
+        static Counters counters(typeid(T).name());
+        return counters;
+    }
+
+    namespace detail {
+
+        inline void Add(std::atomic<size_t>& counter, size_t value) noexcept {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        inline void UpdatePeak(std::atomic<size_t>& peak, size_t value) noexcept {
+            size_t current = peak.load(std::memory_order_relaxed);
+            while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+    }  // namespace detail
+
+    // Выделен буфер под capacity элементов
+    template <typename T>
+    void OnAllocate(size_t capacity) noexcept {
+        if constexpr (ENABLED) {
+            Counters& counters = CountersFor<T>();
+            detail::Add(counters.allocations, 1);
+            detail::Add(counters.bytes_allocated, capacity * sizeof(T));
+            detail::UpdatePeak(counters.peak_capacity, capacity);
+        }
+    }
+
+    template <typename T>
+    void OnDeallocate() noexcept {
+        if constexpr (ENABLED) {
+            detail::Add(CountersFor<T>().deallocations, 1);
+        }
+    }
+
+    // Буфер вырос с old_capacity до new_capacity средствами аллокатора, без переноса элементов вектором
+    template <typename T>
+    void OnGrowInPlace(size_t old_capacity, size_t new_capacity) noexcept {
+        if constexpr (ENABLED) {
+            Counters& counters = CountersFor<T>();
+            detail::Add(counters.in_place_growths, 1);
+            detail::Add(counters.bytes_allocated, (new_capacity - old_capacity) * sizeof(T));
+            detail::UpdatePeak(counters.peak_capacity, new_capacity);
+        }
+    }
+
+    template <typename T>
+    void OnReallocate(ReallocationCause cause) noexcept {
+        if constexpr (ENABLED) {
+            Counters& counters = CountersFor<T>();
+            switch (cause) {
+            case ReallocationCause::EMPLACE_BACK:
+                detail::Add(counters.emplace_back_reallocations, 1);
+                break;
+            case ReallocationCause::EMPLACE:
+                detail::Add(counters.emplace_reallocations, 1);
+                break;
+            case ReallocationCause::INSERT:
+                detail::Add(counters.insert_reallocations, 1);
+                break;
+            case ReallocationCause::RESERVE:
+                detail::Add(counters.reserve_reallocations, 1);
+                break;
+            case ReallocationCause::SHRINK_TO_FIT:
+                detail::Add(counters.shrink_reallocations, 1);
+                break;
+            }
+        }
+    }
+
+    template <typename T>
+    void OnRelocateBitwise(size_t count) noexcept {
+        if constexpr (ENABLED) {
+            detail::Add(CountersFor<T>().elements_relocated_bitwise, count);
+        }
+    }
+
+    template <typename T>
+    void OnMove(size_t count) noexcept {
+        if constexpr (ENABLED) {
+            detail::Add(CountersFor<T>().elements_moved, count);
+        }
+    }
+
+    template <typename T>
+    void OnCopy(size_t count) noexcept {
+        if constexpr (ENABLED) {
+            detail::Add(CountersFor<T>().elements_copied, count);
+        }
+    }
+
+    // Выводит счётчики всех типов, для которых были события
+    inline void Dump(std::ostream& out) {
+        for (const Counters* counters = Counters::head.load(std::memory_order_acquire); counters != nullptr;
+            counters = counters->next) {
+            out << counters->type_name
+                << ": allocations=" << counters->allocations
+                << " deallocations=" << counters->deallocations
+                << " bytes_allocated=" << counters->bytes_allocated
+                << " in_place_growths=" << counters->in_place_growths
+                << " reallocations(emplace_back/emplace/insert/reserve/shrink)="
+                << counters->emplace_back_reallocations << '/' << counters->emplace_reallocations << '/'
+                << counters->insert_reallocations << '/' << counters->reserve_reallocations << '/'
+                << counters->shrink_reallocations
+                << " relocated(bitwise/moved/copied)="
+                << counters->elements_relocated_bitwise << '/' << counters->elements_moved << '/'
+                << counters->elements_copied
+                << " peak_capacity=" << counters->peak_capacity << '\n';
+        }
+    }
+
+}  // namespace stats
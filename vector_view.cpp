@@ -0,0 +1,75 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Невладеющее представление непрерывного массива элементов: Vector, SmallVector и других
+// контейнеров, у которых begin() возвращает указатель. Позволяет читать содержимое без копирования
+template <typename T>
+class VectorView {
+    template <typename Container>
+    using EnableIfContiguous = std::enable_if_t<
+        std::is_convertible_v<decltype(std::declval<Container&>().begin()), T*>
+        && std::is_convertible_v<decltype(std::declval<Container&>().Size()), size_t>>;
+public:
+    using iterator = T*;
+    using const_iterator = T*;
+
+    VectorView() = default;
+
+    VectorView(T* data, size_t size) noexcept
+        : data_(data)
+        , size_(size) {
+    }
+
+    template <typename Container, typename = EnableIfContiguous<Container>>
+    VectorView(Container& container) noexcept
+        : data_(container.begin())
+        , size_(container.Size()) {
+    }
+
+    // Представление неизменяемых элементов строится и из представления изменяемых
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    VectorView(VectorView<U> other) noexcept
+        : data_(other.begin())
+        , size_(other.Size()) {
+    }
+
+    iterator begin() const noexcept {
+        return data_;
+    }
+    iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    T* GetAddress() const noexcept {
+        return data_;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    T& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    // Представление count элементов, начиная с offset
+    VectorView Subview(size_t offset, size_t count) const noexcept {
+        assert(offset <= size_ && count <= size_ - offset);
+        return VectorView(data_ + offset, count);
+    }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename Container>
+VectorView(Container&) -> VectorView<std::remove_pointer_t<decltype(std::declval<Container&>().begin())>>;